@@ -10,6 +10,10 @@
 #include "button.h"
 #include <string.h>
 
+#if BTN_USER_READ_PIN_ROUTINE && !defined(BTN_READ_PIN)
+#error "BTN_USER_READ_PIN_ROUTINE requires BTN_READ_PIN(Port, Pin) to be defined"
+#endif
+
 #if BTN_FORCE_NON_HAL
 #undef USE_HAL_DRIVER
 #define HAL_TO_DEFINE
@@ -25,7 +29,7 @@
 
 #if BTN_TICK_FROM_FUNC
 static BTN_TIME_t (*BTN_get_tick)(void) = NULL;
-#define BTN_GET_TICK ((SM_get_tick != NULL) ? BTN_get_tick() : ((BTN_TIME_t)0))
+#define BTN_GET_TICK ((BTN_get_tick != NULL) ? BTN_get_tick() : ((BTN_TIME_t)0))
 BTN_operate_status BTN_tick_function_register(BTN_TIME_t (*Function)(void))
 {
     if (Function == NULL)
@@ -37,9 +41,9 @@ BTN_operate_status BTN_tick_function_register(BTN_TIME_t (*Function)(void))
     return BTN_OK;
 }
 #else
-BTN_TIME_t *BTN_tick = NULL;
-#define BTN_GET_TICK (*(BTN_tick))
-BTN_operate_status BTN_tick_variable_register(BTN_TIME_t *Variable)
+static volatile BTN_TICK_VARIABLE_T *BTN_tick = NULL;
+#define BTN_GET_TICK ((BTN_tick != NULL) ? (BTN_TIME_t)(*(BTN_tick)) : ((BTN_TIME_t)0))
+BTN_operate_status BTN_tick_variable_register(volatile BTN_TICK_VARIABLE_T *Variable)
 {
     if (Variable == NULL)
     {
@@ -51,6 +55,52 @@ BTN_operate_status BTN_tick_variable_register(BTN_TIME_t *Variable)
 }
 #endif
 
+/**
+ * @brief Returns the current tick of the registered time source.
+ *
+ * @return The current tick, or 0 if no time source is registered.
+ */
+BTN_TIME_t ButtonGetTick(void)
+{
+    return BTN_GET_TICK;
+}
+
+/*
+ * Time elapsed between two timestamps, computed modulo the width of
+ * `BTN_TIME_t`. The cast keeps the difference correct across tick wraparound
+ * for time bases narrower than `int` as well.
+ */
+#define BTN_ELAPSED(Now, Since) ((BTN_TIME_t)((BTN_TIME_t)(Now) - (BTN_TIME_t)(Since)))
+
+/*
+ * Access to the button configuration. With `BTN_SHARED_CONFIG` the button only
+ * references it; the setters write through the pointer and therefore require
+ * a configuration located in RAM.
+ */
+#if BTN_SHARED_CONFIG
+#define BTN_CFG(Key) ((Key)->Config)
+#define BTN_CFG_RW(Key) ((button_config_t *)(Key)->Config)
+#define BTN_CFG_VALID(Key) ((Key)->Config != NULL)
+#else
+#define BTN_CFG(Key) (&(Key)->Config)
+#define BTN_CFG_RW(Key) (&(Key)->Config)
+#define BTN_CFG_VALID(Key) 1
+#endif
+
+/*
+ * Non-zero if a configuration returned by `ButtonConfigEdit()` is the one the
+ * button is running on, so runtime state tied to it can be reset at once.
+ */
+#define BTN_CFG_IN_PLACE(Key, Edit) ((const button_config_t *)(Edit) == BTN_CFG(Key))
+
+#if BTN_ATOMIC_CONFIG && (!BTN_SHARED_CONFIG || !BTN_EVENT_QUEUE)
+#error "BTN_ATOMIC_CONFIG requires BTN_SHARED_CONFIG and BTN_EVENT_QUEUE"
+#endif
+
+#if BTN_STATIC_TABLE && (!BTN_SHARED_CONFIG || !BTN_PIN_TABLE)
+#error "BTN_STATIC_TABLE requires BTN_SHARED_CONFIG and BTN_PIN_TABLE"
+#endif
+
 /* ========================== Helper Functions ========================= */
 /**
  * @brief Reads the state of a specified GPIO pin.
@@ -69,7 +119,7 @@ BTN_operate_status BTN_tick_variable_register(BTN_TIME_t *Variable)
 static uint8_t ReadState(BTN_GPIO_PORT_T *GPIOx, BTN_GPIO_PIN_T GPIO_Pin)
 {
 #if BTN_USER_READ_PIN_ROUTINE
-
+    return BTN_READ_PIN(GPIOx, GPIO_Pin) ? BTN_SET : BTN_RESET;
 #else
 #ifdef USE_HAL_DRIVER
     return HAL_GPIO_ReadPin(GPIOx, GPIO_Pin);
@@ -86,777 +136,5245 @@ static uint8_t ReadState(BTN_GPIO_PORT_T *GPIOx, BTN_GPIO_PIN_T GPIO_Pin)
 #endif
 }
 
-#if BTN_MULTIPLE_CLICK
+#if BTN_GROUP
 /**
- * @brief Helper function for handling multiple button clicks during the
- * debounce state.
+ * @brief Reads the input register of a whole GPIO port.
  *
- * This function processes multiple button clicks based on the current multiple
- * click mode and the time elapsed between successive clicks. It updates the
- * click counter and triggers appropriate callback functions for single, double,
- * or triple clicks, depending on the configuration.
+ * Used by the group processing to take a single snapshot of all pins of a port
+ * per pass. Direct register access is used in both HAL and non-HAL builds,
+ * since the HAL does not provide a port-wide read.
  *
- * Multiple click modes:
- * - `BTN_MULTIPLE_CLICK_OFF`: No multiple click handling, processes single
- * clicks only.
- * - `BTN_MULTIPLE_CLICK_NORMAL_MODE`: Handles single, double, and triple clicks
- * with individual callbacks.
- * - `BTN_MULTIPLE_CLICK_COMBINED_MODE`: Aggregates multiple clicks into a
- * combined mode with optional maximum click handling.
+ * @param GPIOx Pointer to the GPIO port (e.g., GPIOA, GPIOB).
+ * @return The input levels of the port's pins as a pin mask.
+ */
+static BTN_GPIO_PIN_T ReadPort(BTN_GPIO_PORT_T *GPIOx)
+{
+    return (BTN_GPIO_PIN_T)GPIOx->IDR;
+}
+#endif
+
+/**
+ * @brief Converts a raw pin level into the logical pressed state of a button.
  *
- * @param Key Pointer to the button structure for which multiple clicks are
- * being processed.
+ * With `NON_REVERSE` logic the button is active-low (pressed when the pin reads
+ * `BTN_RESET`); with `REVERSE` logic it is active-high.
  *
- * @note This function is static and used internally within the debounce state
- * logic. It is called automatically as part of the button state machine.
+ * @param Key Pointer to the button structure.
+ * @param PinState The raw pin level (`BTN_SET` or `BTN_RESET`).
+ * @return 1 if the button is pressed, 0 otherwise.
+ */
+static uint8_t ButtonIsActive(const button_t *Key, uint8_t PinState)
+{
+    return (PinState == BTN_SET) == (BTN_CFG(Key)->ReverseLogic == REVERSE);
+}
+
+/* ========================== Event Delivery ========================= */
+#if !BTN_EVENT_HANDLER
+/**
+ * @brief Returns the user callback registered for a button event.
  *
- * @return None
+ * @param Key Pointer to the button structure.
+ * @param Event The event whose callback is requested.
+ * @return The registered callback, or NULL if none is registered (or the
+ * event is not compiled in).
  */
-static void MultipleClickDebounce(button_t *Key)
+static void (*ButtonEventCallback(const button_t *Key, button_event_t Event))(uint16_t)
 {
-    if (Key->MultipleClickMode == BTN_MULTIPLE_CLICK_OFF)
-    {
-        Key->LastTick = BTN_GET_TICK;
-        if (Key->ButtonPressed != NULL)
-        {
-            Key->ButtonPressed(Key->NumberBtn);
-        }
-        return;
-    }
-    else if (Key->MultipleClickMode == BTN_MULTIPLE_CLICK_NORMAL_MODE)
-    {
-        Key->LastTick = BTN_GET_TICK;
-        if (Key->ButtonPressed != NULL)
-        {
-            Key->ButtonPressed(Key->NumberBtn);
-        }
-        if (BTN_GET_TICK - Key->LastClickTick <= Key->TimerBetweenClick)
-        {
-            Key->ClickCounter++;
-            if (Key->ClickCounter > 3)
-            {
-                Key->ClickCounter = 0;
-                return;
-            }
-            switch (Key->ClickCounter)
-            {
-            case 2:
-                if (Key->ButtonDoubleClick != NULL)
-                    Key->ButtonDoubleClick(Key->NumberBtn);
-                break;
-            case 3:
-                if (Key->ButtonTripleClick != NULL)
-                    Key->ButtonTripleClick(Key->NumberBtn);
-                break;
-            default:
-                break;
-            }
-        }
-        else
-            Key->ClickCounter = 0;
-    }
-    else if (Key->MultipleClickMode == BTN_MULTIPLE_CLICK_COMBINED_MODE && Key->ClickCounterCycle == 0)
+    switch (Event)
     {
-        Key->ClickCounterCycle = 1;
-        if (BTN_GET_TICK - Key->LastClickTick <= Key->TimerBetweenClick)
-        {
-            Key->ClickCounter++;
-            if (Key->ClickCounter > 3)
-            {
-#if BTN_MULTIPLE_CLICK_COMBINED_TO_MUCH_AS_TRIPLE
-                Key->ClickCounter = 3;
-#else
-                Key->ClickCounter = 0;
+    case BTN_EVENT_PRESSED:
+        return BTN_CFG(Key)->ButtonPressed;
+    case BTN_EVENT_LONG_PRESSED:
+        return BTN_CFG(Key)->ButtonLongPressed;
+    case BTN_EVENT_REPEAT:
+        return BTN_CFG(Key)->ButtonRepeat;
+    case BTN_EVENT_RELEASE:
+        return BTN_CFG(Key)->ButtonRelease;
+#if BTN_RELEASE_AFTER_REPEAT
+    case BTN_EVENT_RELEASE_AFTER_REPEAT:
+        return BTN_CFG(Key)->ButtonReleaseAfterRepeat;
 #endif
-            }
-        }
-        else
-            Key->ClickCounter = 1;
+#if BTN_MULTIPLE_CLICK
+    case BTN_EVENT_DOUBLE_CLICK:
+        return BTN_CFG(Key)->ButtonDoubleClick;
+    case BTN_EVENT_TRIPLE_CLICK:
+        return BTN_CFG(Key)->ButtonTripleClick;
+#endif
+#if BTN_NON_USED_CALLBACK
+    case BTN_EVENT_NON_USED:
+        return BTN_CFG(Key)->ButtonNonUsed;
+#endif
+#if BTN_ENCODER
+    case BTN_EVENT_ROTATE_CW:
+        return BTN_CFG(Key)->ButtonRotateCw;
+    case BTN_EVENT_ROTATE_CCW:
+        return BTN_CFG(Key)->ButtonRotateCcw;
+#endif
+    default:
+        return NULL;
     }
 }
+#endif
+
 /**
- * @brief Helper function for handling multiple button clicks during the repeat
- * state.
- *
- * This function processes multiple button clicks when the button is in the
- * repeat state and the multiple click mode is set to
- * `BTN_MULTIPLE_CLICK_COMBINED_MODE`. It evaluates the number of clicks
- * registered within the allowed time frame (`TimerBetweenClick`) and triggers
- * the appropriate callback functions for single, double, or triple clicks.
- *
- * Actions performed:
- * - Resets the combined mode repeat press flag and click cycle counter.
- * - Checks the elapsed time since the last click (`LastClickTick`).
- * - Invokes the callback function corresponding to the number of clicks
- * detected.
+ * @brief Checks whether an event of the button has a receiver.
  *
- * @param Key Pointer to the button structure for which multiple clicks are
- * being processed.
- *
- * @note This function is static and is part of the internal button state
- * machine logic. It only processes clicks when the combined mode is active.
- *
- * @return None
+ * @param Key Pointer to the button structure.
+ * @param Event The event to check.
+ * @return 1 if the event is delivered to the application, 0 if it is
+ * discarded (no callback registered, or masked out in handler mode).
  */
-static void multipleClikIdle(button_t *Key)
+static uint8_t ButtonEventEnabled(const button_t *Key, button_event_t Event)
 {
-    if (Key->MultipleClickMode != BTN_MULTIPLE_CLICK_COMBINED_MODE)
-        return;
-    Key->CombinedModeRepeatPressEx = 0;
-    Key->ClickCounterCycle = 0;
-    if (BTN_GET_TICK - Key->LastClickTick > Key->TimerBetweenClick)
+#if BTN_EVENT_HANDLER
+    return BTN_CFG(Key)->Handler != NULL && (BTN_CFG(Key)->EventMask & BTN_EVENT_MASK(Event)) != 0U;
+#else
+#if BTN_MULTIPLE_CLICK
+    if (Event == BTN_EVENT_CLICK_COUNT)
     {
-        switch (Key->ClickCounter)
-        {
-        case 1:
-            if (Key->ButtonPressed != NULL)
-                Key->ButtonPressed(Key->NumberBtn);
-            break;
-        case 2:
-            if (Key->ButtonDoubleClick != NULL)
-                Key->ButtonDoubleClick(Key->NumberBtn);
-            break;
-        case 3:
-            if (Key->ButtonTripleClick != NULL)
-                Key->ButtonTripleClick(Key->NumberBtn);
-            break;
-        default:
-            break;
-        }
-        Key->ClickCounter = 0;
+        return BTN_CFG(Key)->ButtonClickCount != NULL;
     }
+#endif
+    return ButtonEventCallback(Key, Event) != NULL;
+#endif
 }
 
+#if BTN_STATS
+/* ================================ Statistics ================================
+ */
 /**
- * @brief Helper function for handling multiple button clicks during the repeat
- * state.
- *
- * This function manages the behavior of the button in
- * `BTN_MULTIPLE_CLICK_COMBINED_MODE` during the repeat state. It ensures the
- * single press callback (`ButtonPressed`) is executed only once per repeat
- * cycle and resets the click counter.
- *
- * Actions performed:
- * - Invokes the single press callback if it hasn't already been triggered in
- * the current repeat cycle.
- * - Sets the `CombinedModeRepeatPressEx` flag to prevent duplicate callback
- * executions.
- * - Resets the `ClickCounter` to ensure no additional clicks are processed in
- * this state.
- *
- * @param Key Pointer to the button structure for which the repeat state is
- * being processed.
+ * @brief Increments a statistics counter, saturating at its maximum.
  *
- * @note This function is static and part of the internal button state machine
- * logic. It is specifically used when combined click mode is active.
+ * @param Counter Pointer to the counter.
  *
  * @return None
  */
-static void multipleClikRepeat(button_t *Key)
+static void ButtonStatsCount(uint16_t *Counter)
 {
-    if (Key->ButtonPressed != NULL && !Key->CombinedModeRepeatPressEx)
+    if (*Counter != UINT16_MAX)
     {
-        Key->ButtonPressed(Key->NumberBtn);
-        Key->CombinedModeRepeatPressEx = 1;
+        (*Counter)++;
     }
-    Key->ClickCounter = 0;
 }
-#endif
 
-static void ButtonResetInstance(button_t *Key)
+/**
+ * @brief Clears the statistics of a button.
+ *
+ * @param Key Pointer to the button structure.
+ *
+ * @return None
+ */
+static void ButtonStatsClear(button_t *Key)
 {
-    memset(Key, 0, sizeof(button_t));
+    memset(&Key->Stats, 0, sizeof(Key->Stats));
+    Key->Stats.PressMin = BTN_MAX_TIMEOUT;
+    Key->StatsRunning = 0;
 }
 
-/* ========================== Initialization Functions =========================
- */
 /**
- * @brief Initializes a button structure with the provided parameters.
+ * @brief Records one pass of the state machine: the gap since the previous
+ * pass and input bounces during debouncing.
  *
- * This function sets the initial state of the button, configures its associated
- * GPIO port and pin, and initializes timers for debounce, long press, and
- * repeat events. It also sets the button's reverse logic mode and assigns a
- * unique identifier.
+ * @param Key Pointer to the button structure being processed.
+ * @param Active Logical pressed state of the button in this pass.
+ * @param Now Tick of the current pass.
  *
- * @param Key Pointer to the button structure to initialize.
- * @param GpioPort GPIO port where the button is connected.
- * @param GpioPin GPIO pin where the button is connected.
- * @param TimerDebounce Debounce time in milliseconds to filter button noise.
- * @param TimerLongPressed Time in milliseconds to detect a long press.
- * @param TimerRepeat Time in milliseconds for repeated press events.
- * @param ReverseLogic Indicates whether the GPIO uses reverse logic
- * (active-low).
- * @param Number Button identifier passed to callback functions.
- * @return Status of the initialization:
- *         - `BTN_OK` if initialization is successful.
- *         - `BTN_ERROR` if there was an error during initialization.
+ * @return None
  */
-BTN_operate_status ButtonInitKey(button_t *Key, BTN_GPIO_PORT_T *GpioPort, BTN_GPIO_PIN_T GpioPin,
-                                 BTN_TIME_t TimerDebounce, BTN_TIME_t TimerLongPressed, BTN_TIME_t TimerRepeat,
-                                 ReverseLogicGpio_t ReverseLogic, uint16_t Number)
+static void ButtonStatsPass(button_t *Key, uint8_t Active, BTN_TIME_t Now)
 {
-    if (Key == NULL || GpioPort == NULL)
+    if (Key->StatsRunning)
     {
-        return BTN_ERROR;
-    }
-    ButtonResetInstance(Key);
-    Key->State = IDLE;
-    Key->LastTick = BTN_GET_TICK;
-    Key->GpioPort = GpioPort;
-    Key->GpioPin = GpioPin;
-    Key->TimerDebounce = TimerDebounce;
-    Key->TimerLongPressed = TimerLongPressed;
-    Key->TimerRepeat = TimerRepeat;
+        BTN_TIME_t Gap = BTN_ELAPSED(Now, Key->StatsLastTick);
 
-    Key->ReverseLogic = ReverseLogic;
-    Key->NumberBtn = Number;
+        if (Gap > Key->Stats.MaxTaskGap)
+        {
+            Key->Stats.MaxTaskGap = Gap;
+        }
+    }
+    Key->StatsLastTick = Now;
+    Key->StatsRunning = 1;
 
 #if BTN_DOUBLE_DEBOUNCING
-    Key->TimerSecondDebounce = TimerDebounce;
-#endif
-
-#if BTN_MULTIPLE_CLICK
-    Key->MultipleClickMode = BTN_MULTIPLE_CLICK_OFF;
-#endif
-
-#if BTN_NON_USED_CALLBACK
-    Key->TimerNonUsed = 0;
+    if ((Key->State == DEBOUNCE || Key->State == DEBOUNCE_RELEASE) && (Active != 0U) != Key->StatsLastActive)
+#else
+    if (Key->State == DEBOUNCE && (Active != 0U) != Key->StatsLastActive)
 #endif
-    return BTN_OK;
+    {
+        ButtonStatsCount(&Key->Stats.Bounces);
+    }
+    Key->StatsLastActive = (Active != 0U);
 }
 
-#if BTN_DEFAULT_INIT
 /**
- * @brief Initializes a button structure with default timing values.
- *
- * This function sets the initial state of the button, configures its associated
- * GPIO port and pin, and initializes timers for debounce, long press, and
- * repeat events using predefined default values. It also sets the button's
- * reverse logic mode and assigns a unique identifier.
+ * @brief Records the duration of a completed press.
  *
- * Default timing values:
- * - Debounce time: `BTN_DEFAULT_TIME_DEBOUNCE`
- * - Long press time: `BTN_DEFAULT_TIME_LONG_PRESS`
- * - Repeat time: `BTN_DEFAULT_TIME_REPEAT`
+ * @param Key Pointer to the button structure being processed.
+ * @param Now Tick at which the release was accepted.
  *
- * @param Key Pointer to the button structure to initialize.
- * @param GpioPort GPIO port where the button is connected.
- * @param GpioPin GPIO pin where the button is connected.
- * @param ReverseLogic Indicates whether the GPIO uses reverse logic
- * (active-low).
- * @param Number Button identifier passed to callback functions.
- * @return Status of the initialization:
- *         - `BTN_OK` if initialization is successful.
- *         - `BTN_ERROR` if there was an error during initialization.
+ * @return None
  */
-BTN_operate_status ButtonInitKeyDefault(button_t *Key, BTN_GPIO_PORT_T *GpioPort, BTN_GPIO_PIN_T GpioPin,
-                                        ReverseLogicGpio_t ReverseLogic, uint16_t Number)
+static void ButtonStatsPress(button_t *Key, BTN_TIME_t Now)
 {
-    if (Key == NULL || GpioPort == NULL)
+    BTN_TIME_t Duration = BTN_ELAPSED(Now, Key->StatsPressTick);
+    BTN_TIME_t Scaled = (BTN_TIME_t)(Duration >> BTN_STATS_HISTOGRAM_SHIFT);
+    uint8_t Bin = 0;
+
+    while (Scaled != 0U && Bin < (BTN_STATS_HISTOGRAM_BINS - 1))
     {
-        return BTN_ERROR;
+        Scaled = (BTN_TIME_t)(Scaled >> 1);
+        Bin++;
     }
 
-    ButtonResetInstance(Key);
-    Key->State = IDLE;
-    Key->LastTick = BTN_GET_TICK;
-    Key->GpioPort = GpioPort;
-    Key->GpioPin = GpioPin;
-    Key->TimerDebounce = BTN_DEFAULT_TIME_DEBOUNCE;
-    Key->TimerLongPressed = BTN_DEFAULT_TIME_LONG_PRESS;
-    Key->TimerRepeat = BTN_DEFAULT_TIME_REPEAT;
-
-    Key->ReverseLogic = ReverseLogic;
-    Key->NumberBtn = Number;
-
-#if BTN_DOUBLE_DEBOUNCING
-    Key->TimerSecondDebounce = BTN_DEFAULT_TIME_DEBOUNCE;
+    ButtonStatsCount(&Key->Stats.Presses);
+    ButtonStatsCount(&Key->Stats.PressHistogram[Bin]);
+    if (Duration < Key->Stats.PressMin)
+    {
+        Key->Stats.PressMin = Duration;
+    }
+    if (Duration > Key->Stats.PressMax)
+    {
+        Key->Stats.PressMax = Duration;
+    }
+}
 #endif
 
-#if BTN_MULTIPLE_CLICK
-    Key->MultipleClickMode = BTN_MULTIPLE_CLICK_OFF;
+/*
+ * Info record of the event whose callback is running, for
+ * `ButtonGetEventInfo()`; NULL outside of callbacks.
+ */
+static const button_event_info_t *BTN_EventInfo = NULL;
+
+/**
+ * @brief Calls the application for a button event.
+ *
+ * In handler mode (`BTN_EVENT_HANDLER`) the button's single event handler is
+ * called with the event and its info record; otherwise the callback
+ * registered for the event is called with the button number (and the click
+ * count for `BTN_EVENT_CLICK_COUNT`). The info record stays readable through
+ * `ButtonGetEventInfo()` for the duration of the call. With `BTN_STATS`
+ * enabled the time spent in the call is recorded.
+ *
+ * @param Key Pointer to the button that produced the event.
+ * @param Event The event that occurred.
+ * @param Info Additional information about the event.
+ *
+ * @return None
+ */
+static void ButtonEventInvoke(button_t *Key, button_event_t Event, const button_event_info_t *Info)
+{
+#if BTN_STATS
+    uint32_t Start;
+    uint32_t Spent;
+#endif
+#if !BTN_EVENT_HANDLER
+    void (*Callback)(uint16_t) = ButtonEventCallback(Key, Event);
 #endif
 
-#if BTN_NON_USED_CALLBACK
-    Key->TimerNonUsed = 0;
+    if (!ButtonEventEnabled(Key, Event))
+    {
+        return;
+    }
+#if BTN_STATS
+    Start = BTN_STATS_CLOCK();
+#endif
+    BTN_EventInfo = Info;
+#if BTN_EVENT_HANDLER
+    BTN_CFG(Key)->Handler(Key->NumberBtn, Event, Info);
+#elif BTN_MULTIPLE_CLICK
+    if (Event == BTN_EVENT_CLICK_COUNT)
+    {
+        BTN_CFG(Key)->ButtonClickCount(Key->NumberBtn, Info->Clicks);
+    }
+    else
+    {
+        Callback(Key->NumberBtn);
+    }
+#else
+    Callback(Key->NumberBtn);
+#endif
+    BTN_EventInfo = NULL;
+#if BTN_STATS
+    Spent = BTN_STATS_CLOCK() - Start;
+    if (Spent > Key->Stats.MaxCallbackTime)
+    {
+        Key->Stats.MaxCallbackTime = Spent;
+    }
 #endif
-    return BTN_OK;
 }
+
+#if BTN_EVENT_QUEUE
+#if (BTN_EVENT_QUEUE_SIZE < 2) || (BTN_EVENT_QUEUE_SIZE > 128) ||                                               \
+    ((BTN_EVENT_QUEUE_SIZE & (BTN_EVENT_QUEUE_SIZE - 1)) != 0)
+#error "BTN_EVENT_QUEUE_SIZE must be a power of two between 2 and 128"
+#endif
+#if (BTN_EVENT_QUEUE_COUNT < 1) || (BTN_EVENT_QUEUE_COUNT > 8)
+#error "BTN_EVENT_QUEUE_COUNT must be between 1 and 8"
+#endif
+
+/*
+ * Queue receiving the events of a button.
+ */
+#if BTN_EVENT_QUEUE_COUNT > 1
+#define BTN_EVENT_QUEUE_OF(Key) ((Key)->Queue)
+#else
+#define BTN_EVENT_QUEUE_OF(Key) 0U
 #endif
 
-#if BTN_MULTIPLE_CLICK
 /**
- * @brief Sets the multiple click mode and the timer between clicks for the
- * button.
+ * @brief Single queued button event.
+ */
+typedef struct
+{
+    button_t *Key;            /**< Button that produced the event (its `NumberBtn` is the id). */
+    button_event_info_t Info; /**< Tick and payload of the event. */
+    uint8_t Event;            /**< The `button_event_t` that occurred. */
+} button_event_record_t;
+
+/*
+ * Single-producer/single-consumer ring buffers, one per queue. `BTN_EventHead`
+ * is written only by the producer (the context running the tasks of the
+ * queue's buttons), `BTN_EventTail` only by the consumer
+ * (`ButtonDispatchEvents`). Both are free-running 8-bit indices, so every
+ * access is a single atomic load or store on any target.
+ */
+static button_event_record_t BTN_EventBuffer[BTN_EVENT_QUEUE_COUNT][BTN_EVENT_QUEUE_SIZE];
+static volatile uint8_t BTN_EventHead[BTN_EVENT_QUEUE_COUNT];
+static volatile uint8_t BTN_EventTail[BTN_EVENT_QUEUE_COUNT];
+static volatile uint8_t BTN_EventDropped[BTN_EVENT_QUEUE_COUNT];
+
+/**
+ * @brief Pushes an event into the event queue.
  *
- * This function configures the button to operate in different multiple click
- * modes, such as normal or combined, and sets the time between consecutive
- * clicks.
+ * Lock-free and interrupt-safe as long as there is a single producer. The
+ * record is written before the head index is published. If the queue is full,
+ * the event is dropped and reported by the next `ButtonDispatchEvents()`.
  *
- * @param Key Pointer to the button structure.
- * @param MultipleClickMode The mode to handle multiple clicks (e.g.,
- * BTN_MULTIPLE_CLICK_OFF, BTN_MULTIPLE_CLICK_NORMAL_MODE).
- * @param TimerBetweenClick Time in milliseconds between two clicks that are
- * considered part of the same multiple click event.
- * @return Status of the configuration:
- *         - `BTN_OK` if the configuration was successful.
- *         - `BTN_ERROR` if there was an error during configuration.
+ * @param Key Pointer to the button that produced the event.
+ * @param Event The event that occurred.
+ * @param Info Tick and payload of the event.
+ *
+ * @return None
  */
-BTN_operate_status ButtonSetMultipleClick(button_t *Key, MultipleClickMode_t MultipleClickMode,
-                                          BTN_TIME_t TimerBetweenClick)
+static void ButtonEventPush(button_t *Key, button_event_t Event, const button_event_info_t *Info)
 {
-    if (Key == NULL)
+    uint8_t Queue = BTN_EVENT_QUEUE_OF(Key);
+    uint8_t Head = BTN_EventHead[Queue];
+    button_event_record_t *Record = &BTN_EventBuffer[Queue][Head & (BTN_EVENT_QUEUE_SIZE - 1)];
+
+    if ((uint8_t)(Head - BTN_EventTail[Queue]) >= BTN_EVENT_QUEUE_SIZE)
     {
-        return BTN_ERROR;
+        BTN_EventDropped[Queue] = 1;
+        return;
     }
 
-    Key->MultipleClickMode = MultipleClickMode;
-    Key->TimerBetweenClick = TimerBetweenClick;
-    return BTN_OK;
+    Record->Key = Key;
+    Record->Info = *Info;
+    Record->Event = (uint8_t)Event;
+    BTN_MEMORY_BARRIER();
+    BTN_EventHead[Queue] = (uint8_t)(Head + 1);
 }
 #endif
 
-#if BTN_NON_USED_CALLBACK
+#if BTN_REPEAT_PROFILE
 /**
- * @brief Configures the non-used (idle) behavior for a button.
- *
- * This function sets the time threshold for considering a button as unused and
- * assigns a callback function to be executed when the button remains idle for
- * the specified duration.
- *
- * @param Key Pointer to the button instance.
- * @param Miliseconds Time in milliseconds after which the button is considered
- * non-used. If set to 0, the non-used functionality is disabled for this
- * button.
- * @param Callback Pointer to the function to be executed when the button is
- * unused.
- * @return Status of the configuration:
- *         - `BTN_OK` if the configuration was successful.
- *         - `BTN_ERROR` if there was an error during configuration.
+ * @brief Returns the current repeat profile stage of a button.
  *
- * @note Ensure that the `BTN_NON_USED_CALLBACK` macro is enabled in the library
- * configuration to use this functionality.
+ * @param Key Pointer to the button structure.
+ * @return Pointer to the stage, or NULL without a profile. The stage index is
+ * limited to the table, which may have been replaced while the button was held.
  */
-BTN_operate_status ButtonSetNonUsed(button_t *Key, BTN_TIME_t Miliseconds, void *Callback)
+static const button_repeat_stage_t *ButtonRepeatStageOf(const button_t *Key)
 {
-    if (Key == NULL)
+    uint8_t Stage = Key->RepeatStage;
+
+    if (BTN_CFG(Key)->RepeatProfile == NULL)
     {
-        return BTN_ERROR;
+        return NULL;
     }
-
-    Key->TimerNonUsed = Miliseconds;
-    Key->ButtonNonUsed = Callback;
-    return BTN_OK;
+    if (Stage >= BTN_CFG(Key)->RepeatProfileCount)
+    {
+        Stage = (uint8_t)(BTN_CFG(Key)->RepeatProfileCount - 1U);
+    }
+    return &BTN_CFG(Key)->RepeatProfile[Stage];
 }
-#endif
 
-/* ========================== Button State Handlers ==========================
- */
 /**
- * @brief Handles the idle state of the button.
+ * @brief Returns the interval until the next repeat of a button.
  *
- * This function processes the button's behavior when it is in the idle state.
- * It checks for a button press event, transitions the button state to debounce
- * if a press is detected, and handles any multiple click logic if enabled.
+ * @param Key Pointer to the button structure.
+ * @return The interval of the current repeat profile stage, or `TimerRepeat`
+ * without a profile.
+ */
+static BTN_TIME_t ButtonRepeatTime(const button_t *Key)
+{
+    const button_repeat_stage_t *Stage = ButtonRepeatStageOf(Key);
+
+    return (Stage != NULL) ? Stage->Interval : BTN_CFG(Key)->TimerRepeat;
+}
+
+/**
+ * @brief Returns the step multiplier reported with the repeats of a button.
  *
- * Actions performed:
- * - Invokes the `multipleClikIdle` function if multiple click handling is
- * enabled (`BTN_MULTIPLE_CLICK`).
- * - Reads the current GPIO pin state and compares it with the expected state
- * based on the reverse logic configuration.
- * - If a press is detected, updates the `LastTick` timestamp and transitions
- * the button state to `DEBOUNCE`.
+ * @param Key Pointer to the button structure.
+ * @return The step of the current repeat profile stage, or 1 without a
+ * profile.
+ */
+static uint16_t ButtonRepeatStep(const button_t *Key)
+{
+    const button_repeat_stage_t *Stage = ButtonRepeatStageOf(Key);
+
+    return (Stage != NULL) ? Stage->Step : 1U;
+}
+
+/**
+ * @brief Counts a repeat and moves to the next profile stage once its repeat
+ * count is reached.
  *
  * @param Key Pointer to the button structure being processed.
  *
- * @note This function is static and part of the internal state machine for
- * button handling.
- *
  * @return None
  */
-static void ButtonIdleRoutine(button_t *Key)
+static void ButtonRepeatAdvance(button_t *Key)
 {
-#if BTN_MULTIPLE_CLICK
-    multipleClikIdle(Key);
-#endif
-    if (ReadState(Key->GpioPort, Key->GpioPin) == (Key->ReverseLogic == 0) ? BTN_RESET : BTN_SET)
+    const button_repeat_stage_t *Profile = BTN_CFG(Key)->RepeatProfile;
+
+    if (Key->RepeatCount != UINT16_MAX)
     {
-        Key->LastTick = BTN_GET_TICK;
-        Key->State = DEBOUNCE;
+        Key->RepeatCount++;
     }
-#if BTN_NON_USED_CALLBACK
-    if (Key->TimerNonUsed && (BTN_GET_TICK - Key->LastTick >= Key->TimerNonUsed))
+    if (Profile == NULL)
+    {
+        return;
+    }
+    while ((uint8_t)(Key->RepeatStage + 1U) < BTN_CFG(Key)->RepeatProfileCount &&
+           Key->RepeatCount >= Profile[Key->RepeatStage + 1U].After)
     {
-        Key->LastTick = BTN_GET_TICK;
-        if (NULL != Key->ButtonNonUsed)
-            Key->ButtonNonUsed(Key->NumberBtn);
+        Key->RepeatStage++;
     }
-#endif
 }
+#endif
 
+#if BTN_EVENT_PRESS_INFO
 /**
- * @brief Handles the debounce state of the button.
- *
- * This function processes the button's behavior during the debounce state. It
- * verifies if the debounce timer has elapsed and determines whether the button
- * press is valid based on the GPIO pin state. Depending on the configuration,
- * it transitions the state to `PRESSED` or back to `IDLE` and triggers the
- * appropriate callbacks if required.
- *
- * Actions performed:
- * - Checks if the debounce timer (`TimerDebounce`) has elapsed.
- * - Reads the GPIO pin state and compares it with the expected state based on
- * reverse logic.
- * - If a valid press is detected:
- *   - Handles multiple clicks if enabled (`BTN_MULTIPLE_CLICK`) by invoking
- * `MultipleClickDebounce`.
- *   - Updates timestamps (`LastTick` or `LastClickTick`) and transitions the
- * state to `PRESSED`.
- *   - Executes the single press callback (`ButtonPressed`) if multiple click
- * handling is disabled.
- * - If no press is detected, transitions the state back to `IDLE`.
+ * @brief Fills in the press duration and repeat count of an event.
  *
- * @param Key Pointer to the button structure being processed.
+ * While the button is held, `PressTime` is the tick of the accepted press;
+ * from the accepted release on it holds the press duration.
  *
- * @note This function is static and part of the internal state machine for
- * button handling. Multiple click handling is only processed if
- * `BTN_MULTIPLE_CLICK` is enabled.
+ * @param Key Pointer to the button that produced the event.
+ * @param Event The event that occurred.
+ * @param Now Tick of the current pass.
+ * @param Info Info record to fill in.
  *
  * @return None
  */
-static void ButtonDebounceRoutine(button_t *Key)
+static void ButtonEventPressInfo(const button_t *Key, button_event_t Event, BTN_TIME_t Now, button_event_info_t *Info)
 {
-    if ((BTN_GET_TICK - Key->LastTick) >= Key->TimerDebounce)
+    Info->Duration = 0;
+    Info->Repeats = 0;
+    switch (Event)
     {
-        if (ReadState(Key->GpioPort, Key->GpioPin) == (Key->ReverseLogic == 0) ? BTN_RESET : BTN_SET)
-        {
+    case BTN_EVENT_LONG_PRESSED:
+        Info->Duration = BTN_ELAPSED(Now, Key->PressTime);
+        break;
 
-#if BTN_MULTIPLE_CLICK
-            MultipleClickDebounce(Key);
-            Key->State = PRESSED;
-            Key->LastClickTick = BTN_GET_TICK;
-#else
-            Key->State = PRESSED;
-            Key->LastTick = BTN_GET_TICK;
-            if (Key->ButtonPressed != NULL)
-            {
-                Key->ButtonPressed(Key->NumberBtn);
-            }
-#endif
-        }
-        else
-        {
-            Key->State = IDLE;
-        }
+    case BTN_EVENT_REPEAT:
+        Info->Duration = BTN_ELAPSED(Now, Key->PressTime);
+        Info->Repeats = Key->RepeatCount;
+        break;
+
+    case BTN_EVENT_RELEASE:
+    case BTN_EVENT_RELEASE_AFTER_REPEAT:
+        Info->Duration = Key->PressTime;
+        Info->Repeats = Key->RepeatCount;
+        break;
+
+    default:
+        break;
     }
 }
+#endif
 
 /**
- * @brief Handles the pressed state of the button.
- *
- * This function processes the button's behavior during the pressed state. It
- * checks for either a release event or the expiration of the long press timer.
- * Based on the conditions, it transitions the button state to `RELEASE` or
- * `REPEAT` and triggers the long press callback if applicable.
- *
- * Actions performed:
- * - Checks if the button is released (based on the GPIO pin state and reverse
- * logic).
- *   - If released, transitions the state to `RELEASE`.
- * - Checks if the long press timer (`TimerLongPressed`) has elapsed.
- *   - If elapsed, transitions the state to `REPEAT`, updates the `LastTick`
- * timestamp, and invokes the long press callback (`ButtonLongPressed`) if it is
- * set.
+ * @brief Delivers a button event to the user.
  *
- * @param Key Pointer to the button structure being processed.
+ * Events without a receiver are discarded immediately. With
+ * `BTN_EVENT_QUEUE` enabled the event is queued for `ButtonDispatchEvents()`,
+ * otherwise the callback is called synchronously.
  *
- * @note This function is static and part of the internal state machine for
- * button handling.
+ * @param Key Pointer to the button that produced the event.
+ * @param Event The event that occurred.
+ * @param Now Tick of the current pass.
  *
  * @return None
  */
-
-static void ButtonPressedRoutine(button_t *Key)
+static void ButtonDeliver(button_t *Key, button_event_t Event, BTN_TIME_t Now)
 {
-    if (ReadState(Key->GpioPort, Key->GpioPin) == (Key->ReverseLogic == 0) ? BTN_SET : BTN_RESET)
+    button_event_info_t Info;
+
+    if (!ButtonEventEnabled(Key, Event))
     {
-#if BTN_DOUBLE_DEBOUNCING
-        Key->StateBeforeRelease = Key->State;
-        Key->State = DEBOUNCE_RELEASE;
-        Key->LastTickSecondDebounce = BTN_GET_TICK;
+        return;
+    }
+
+    Info.Tick = Now;
+#if BTN_MULTIPLE_CLICK
+    Info.Clicks = (Event == BTN_EVENT_CLICK_COUNT)    ? Key->ClickResult
+                  : (Event == BTN_EVENT_DOUBLE_CLICK) ? 2U
+                  : (Event == BTN_EVENT_TRIPLE_CLICK) ? 3U
+                                                      : 0U;
 #else
-        Key->State = RELEASE;
+    Info.Clicks = 0;
 #endif
-    }
-    else if (BTN_GET_TICK - Key->LastTick >= Key->TimerLongPressed)
+#if BTN_REPEAT_PROFILE
+    Info.Step = (Event == BTN_EVENT_REPEAT) ? ButtonRepeatStep(Key) : 0U;
+#else
+    Info.Step = (Event == BTN_EVENT_REPEAT) ? 1U : 0U;
+#endif
+#if BTN_ENCODER
+    if (Event == BTN_EVENT_ROTATE_CW || Event == BTN_EVENT_ROTATE_CCW)
     {
-        Key->State = REPEAT;
-        Key->LastTick = BTN_GET_TICK;
-        if (Key->ButtonLongPressed != NULL)
-        {
-            Key->ButtonLongPressed(Key->NumberBtn);
-        }
+        /* Rotate events only come from encoders, whose first member is `Key`. */
+        Info.Step = ((const button_encoder_t *)(const void *)Key)->Step;
     }
+#endif
+#if BTN_EVENT_PRESS_INFO
+    ButtonEventPressInfo(Key, Event, Now, &Info);
+#else
+    Info.Duration = 0;
+    Info.Repeats = 0;
+#endif
+#if BTN_EVENT_QUEUE
+    ButtonEventPush(Key, Event, &Info);
+#else
+    ButtonEventInvoke(Key, Event, &Info);
+#endif
 }
 
 /**
- * @brief Handles the repeat state of the button.
- *
- * This function processes the button's behavior during the repeat state. It
- * checks for the button release or long press expiration, and handles the
- * repeat callback if the repeat timer has elapsed. Additionally, it handles
- * multiple click logic if enabled.
- *
- * Actions performed:
- * - Invokes the `multipleClikRepeat` function if multiple click handling is
- * enabled (`BTN_MULTIPLE_CLICK`).
- * - Checks if the button is released (based on the GPIO pin state and reverse
- * logic).
- *   - If released, transitions the state to either `RELEASE` or
- * `RELEASE_AFTER_REPEAT` based on the configuration.
- * - Checks if the repeat timer (`TimerRepeat`) has elapsed.
- *   - If elapsed, updates the `LastTick` timestamp and invokes the repeat
- * callback (`ButtonRepeat`) if set.
+ * @brief Emits an event produced by the state machine of a button.
  *
- * @param Key Pointer to the button structure being processed.
+ * With `BTN_CHORD` enabled, the events of a member of a suppressing chord are
+ * filtered first: all events are dropped while the button is muted, and a
+ * press is held back until the chord has been decided. Any other event
+ * delivers a held back press first.
  *
- * @note This function is static and part of the internal state machine for
- * button handling. Multiple click handling is only processed if
- * `BTN_MULTIPLE_CLICK` is enabled.
+ * @param Key Pointer to the button that produced the event.
+ * @param Event The event that occurred.
+ * @param Now Tick of the current pass.
  *
  * @return None
  */
-
-static void ButtonRepeatRoutine(button_t *Key)
+static void ButtonEmit(button_t *Key, button_event_t Event, BTN_TIME_t Now)
 {
-#if BTN_MULTIPLE_CLICK
-    multipleClikRepeat(Key);
-#endif
-    if (ReadState(Key->GpioPort, Key->GpioPin) == (Key->ReverseLogic == 0) ? BTN_SET : BTN_RESET)
+#if BTN_CHORD
+    if (Key->ChordMuted)
     {
-#if BTN_DOUBLE_DEBOUNCING
-        Key->StateBeforeRelease = Key->State;
-        Key->State = DEBOUNCE_RELEASE;
-        Key->LastTickSecondDebounce = BTN_GET_TICK;
-#else
-#if !BTN_RELEASE_AFTER_REPEAT
-        Key->State = RELEASE;
-#else
-        Key->State = RELEASE_AFTER_REPEAT;
-#endif
-#endif
+        return;
     }
-    else if (BTN_GET_TICK - Key->LastTick >= Key->TimerRepeat)
+    if (Key->ChordHold && Event == BTN_EVENT_PRESSED)
     {
-        Key->LastTick = BTN_GET_TICK;
-        if (Key->ButtonRepeat != NULL)
-        {
-            Key->ButtonRepeat(Key->NumberBtn);
-        }
+        Key->ChordPending = 1;
+        return;
+    }
+    if (Key->ChordPending)
+    {
+        Key->ChordPending = 0;
+        ButtonDeliver(Key, BTN_EVENT_PRESSED, Now);
     }
+#endif
+    ButtonDeliver(Key, Event, Now);
 }
 
-#if BTN_DOUBLE_DEBOUNCING
+#if BTN_MULTIPLE_CLICK
 /**
- * @brief Handles the debounce logic for the button release state.
+ * @brief Returns the longest click sequence of a button in combined mode.
  *
- * This routine checks if the button is stable (debounced) after being released.
- * It determines the next state of the button based on its previous state
- * (`StateBeforeRelease`) and the current GPIO pin logic level.
+ * @param Key Pointer to the button structure.
+ * @return `MaxClicks`, or 3 if it is not set.
+ */
+static uint8_t ButtonMaxClicks(const button_t *Key)
+{
+    return (BTN_CFG(Key)->MaxClicks != 0U) ? BTN_CFG(Key)->MaxClicks : 3U;
+}
+
+/**
+ * @brief Checks whether a click sequence longer than `Count` can still be
+ * delivered.
  *
- * @param Key Pointer to the button structure being processed.
+ * @param Key Pointer to the button structure.
+ * @param Count Clicks counted so far.
+ * @return 1 if `Count` is below the maximum and a longer sequence has a
+ * receiver (`ButtonClickCount`, or a double / triple click callback), 0
+ * otherwise.
  */
-static void ButtonDebounceReleaseRoutine(button_t *Key)
+static uint8_t ButtonClicksAbove(const button_t *Key, uint8_t Count)
 {
-    if ((BTN_GET_TICK - Key->LastTickSecondDebounce) >= Key->TimerSecondDebounce)
+    if (Count >= ButtonMaxClicks(Key))
     {
-        if (ReadState(Key->GpioPort, Key->GpioPin) != (Key->ReverseLogic == 0) ? BTN_SET : BTN_RESET)
-        {
-            Key->State = Key->StateBeforeRelease;
-        }
-        else
+        return 0;
+    }
+    if (ButtonEventEnabled(Key, BTN_EVENT_CLICK_COUNT))
+    {
+        return 1;
+    }
+    return (Count < 2U && ButtonEventEnabled(Key, BTN_EVENT_DOUBLE_CLICK)) ||
+           (Count < 3U && ButtonEventEnabled(Key, BTN_EVENT_TRIPLE_CLICK));
+}
+
+/**
+ * @brief Delivers a finished click sequence of a button in combined mode.
+ *
+ * With `MaxClicks` set and a `BTN_EVENT_CLICK_COUNT` receiver the sequence is
+ * delivered as one click count event; otherwise one, two and three clicks are
+ * delivered as a press, a double click and a triple click.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Count Number of clicks of the sequence (0 delivers nothing).
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonClicksFinish(button_t *Key, uint8_t Count, BTN_TIME_t Now)
+{
+    if (Count != 0U && BTN_CFG(Key)->MaxClicks != 0U && ButtonEventEnabled(Key, BTN_EVENT_CLICK_COUNT))
+    {
+        Key->ClickResult = Count;
+        ButtonEmit(Key, BTN_EVENT_CLICK_COUNT, Now);
+        return;
+    }
+    switch (Count)
+    {
+    case 1:
+        ButtonEmit(Key, BTN_EVENT_PRESSED, Now);
+        break;
+    case 2:
+        ButtonEmit(Key, BTN_EVENT_DOUBLE_CLICK, Now);
+        break;
+    case 3:
+        ButtonEmit(Key, BTN_EVENT_TRIPLE_CLICK, Now);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Helper function for handling multiple button clicks during the
+ * debounce state.
+ *
+ * This function processes multiple button clicks based on the current multiple
+ * click mode and the time elapsed between successive clicks. It updates the
+ * click counter and triggers appropriate callback functions for single, double,
+ * or triple clicks, depending on the configuration.
+ *
+ * Multiple click modes:
+ * - `BTN_MULTIPLE_CLICK_OFF`: No multiple click handling, processes single
+ * clicks only.
+ * - `BTN_MULTIPLE_CLICK_NORMAL_MODE`: Handles single, double, and triple clicks
+ * with individual callbacks.
+ * - `BTN_MULTIPLE_CLICK_COMBINED_MODE`: Aggregates multiple clicks into a
+ * combined mode with optional maximum click handling.
+ *
+ * @param Key Pointer to the button structure for which multiple clicks are
+ * being processed.
+ * @param Now Tick of the current pass.
+ *
+ * @note This function is static and used internally within the debounce state
+ * logic. It is called automatically as part of the button state machine.
+ *
+ * @return None
+ */
+static void MultipleClickDebounce(button_t *Key, BTN_TIME_t Now)
+{
+    if (BTN_CFG(Key)->MultipleClickMode == BTN_MULTIPLE_CLICK_OFF)
+    {
+        Key->LastTick = Now;
+        ButtonEmit(Key, BTN_EVENT_PRESSED, Now);
+        return;
+    }
+    else if (BTN_CFG(Key)->MultipleClickMode == BTN_MULTIPLE_CLICK_NORMAL_MODE)
+    {
+        Key->LastTick = Now;
+        ButtonEmit(Key, BTN_EVENT_PRESSED, Now);
+        if (BTN_ELAPSED(Now, Key->LastClickTick) <= BTN_CFG(Key)->TimerBetweenClick)
         {
-#if BTN_RELEASE_AFTER_REPEAT
-            if (Key->StateBeforeRelease == PRESSED)
+            Key->ClickCounter++;
+            if (Key->ClickCounter > 3)
             {
-                Key->State = RELEASE;
+                Key->ClickCounter = 0;
+                return;
             }
-            else if (Key->StateBeforeRelease == REPEAT)
+            switch (Key->ClickCounter)
             {
-                Key->State = RELEASE_AFTER_REPEAT;
+            case 2:
+                ButtonEmit(Key, BTN_EVENT_DOUBLE_CLICK, Now);
+                break;
+            case 3:
+                ButtonEmit(Key, BTN_EVENT_TRIPLE_CLICK, Now);
+                break;
+            default:
+                break;
             }
+        }
+        else
+            Key->ClickCounter = 0;
+    }
+    else if (BTN_CFG(Key)->MultipleClickMode == BTN_MULTIPLE_CLICK_COMBINED_MODE && Key->ClickCounterCycle == 0)
+    {
+        Key->ClickCounterCycle = 1;
+        if (BTN_ELAPSED(Now, Key->LastClickTick) <= BTN_CFG(Key)->TimerBetweenClick)
+        {
+            Key->ClickCounter++;
+            if (Key->ClickCounter > ButtonMaxClicks(Key))
+            {
+#if BTN_MULTIPLE_CLICK_COMBINED_TO_MUCH_AS_TRIPLE
+                Key->ClickCounter = 3;
 #else
-            Key->State = RELEASE;
+                Key->ClickCounter = 0;
 #endif
+            }
+        }
+        else
+            Key->ClickCounter = 1;
+
+        /* Finish early when no longer sequence can be delivered. */
+        if (BTN_CFG(Key)->MaxClicks != 0U && !ButtonClicksAbove(Key, Key->ClickCounter))
+        {
+            ButtonClicksFinish(Key, Key->ClickCounter, Now);
+            Key->ClickCounter = 0;
+            Key->CombinedModeRepeatPressEx = 1;
         }
     }
 }
-#endif
-
 /**
- * @brief Handles the release state of the button.
+ * @brief Helper function for handling multiple button clicks during the repeat
+ * state.
  *
- * This function processes the button's behavior during the release state. It
- * triggers the release callback if defined and transitions the button state
- * back to `IDLE`.
+ * This function processes multiple button clicks when the button is in the
+ * repeat state and the multiple click mode is set to
+ * `BTN_MULTIPLE_CLICK_COMBINED_MODE`. It evaluates the number of clicks
+ * registered within the allowed time frame (`TimerBetweenClick`) and triggers
+ * the appropriate callback functions for single, double, or triple clicks.
  *
  * Actions performed:
- * - Invokes the release callback (`ButtonRelease`) if set, passing the button
- * number as an argument.
- * - Transitions the button state to `IDLE` after handling the release.
+ * - Resets the combined mode repeat press flag and click cycle counter.
+ * - Checks the elapsed time since the last click (`LastClickTick`).
+ * - Invokes the callback function corresponding to the number of clicks
+ * detected.
  *
- * @param Key Pointer to the button structure being processed.
+ * @param Key Pointer to the button structure for which multiple clicks are
+ * being processed.
+ * @param Now Tick of the current pass.
  *
- * @note This function is static and part of the internal state machine for
- * button handling.
+ * @note This function is static and is part of the internal button state
+ * machine logic. It only processes clicks when the combined mode is active.
  *
  * @return None
  */
-
-static void ButtonReleaseRoutine(button_t *Key)
+static void multipleClikIdle(button_t *Key, BTN_TIME_t Now)
 {
-    if (Key->ButtonRelease != NULL)
+    if (BTN_CFG(Key)->MultipleClickMode != BTN_MULTIPLE_CLICK_COMBINED_MODE)
+        return;
+    Key->CombinedModeRepeatPressEx = 0;
+    Key->ClickCounterCycle = 0;
+    if (BTN_ELAPSED(Now, Key->LastClickTick) > BTN_CFG(Key)->TimerBetweenClick)
     {
-        Key->ButtonRelease(Key->NumberBtn);
+        ButtonClicksFinish(Key, Key->ClickCounter, Now);
+        Key->ClickCounter = 0;
     }
-    Key->State = IDLE;
 }
 
-#if BTN_RELEASE_AFTER_REPEAT
 /**
- * @brief Handles the release state after repeat for the button.
+ * @brief Helper function for handling multiple button clicks during the repeat
+ * state.
  *
- * This function processes the button's behavior after a repeat cycle has
- * completed. It triggers the release callback for this state if defined and
- * transitions the button state back to `IDLE`.
+ * This function manages the behavior of the button in
+ * `BTN_MULTIPLE_CLICK_COMBINED_MODE` during the repeat state. It ensures the
+ * single press callback (`ButtonPressed`) is executed only once per repeat
+ * cycle and resets the click counter.
  *
  * Actions performed:
- * - Invokes the release after repeat callback (`ButtonReleaseAfterRepeat`) if
- * set, passing the button number as an argument.
- * - Transitions the button state to `IDLE` after handling the release.
+ * - Invokes the single press callback if it hasn't already been triggered in
+ * the current repeat cycle.
+ * - Sets the `CombinedModeRepeatPressEx` flag to prevent duplicate callback
+ * executions.
+ * - Resets the `ClickCounter` to ensure no additional clicks are processed in
+ * this state.
  *
- * @param Key Pointer to the button structure being processed.
+ * @param Key Pointer to the button structure for which the repeat state is
+ * being processed.
+ * @param Now Tick of the current pass.
  *
- * @note This function is static and part of the internal state machine for
- * button handling, specifically for the state after repeat when
- * `BTN_RELEASE_AFTER_REPEAT` is enabled.
+ * @note This function is static and part of the internal button state machine
+ * logic. It is specifically used when combined click mode is active.
+ *
+ * @return None
+ */
+static void multipleClikRepeat(button_t *Key, BTN_TIME_t Now)
+{
+    if (ButtonEventEnabled(Key, BTN_EVENT_PRESSED) && !Key->CombinedModeRepeatPressEx)
+    {
+        ButtonEmit(Key, BTN_EVENT_PRESSED, Now);
+        Key->CombinedModeRepeatPressEx = 1;
+    }
+    Key->ClickCounter = 0;
+}
+#endif
+
+#if BTN_ADAPTIVE_DEBOUNCE
+/**
+ * @brief Forgets the learnt settling times of a button.
+ *
+ * Until the next measurement the debounce windows are at their upper bound.
+ *
+ * @param Key Pointer to the button structure.
+ *
+ * @return None
+ */
+static void ButtonAdaptReset(button_t *Key)
+{
+    Key->AdaptPress = BTN_MAX_TIMEOUT;
+#if BTN_DOUBLE_DEBOUNCING
+    Key->AdaptRelease = BTN_MAX_TIMEOUT;
+#endif
+}
+#endif
+
+#if BTN_ATOMIC_CONFIG
+/*
+ * Incremented by every publish, so a group can tell whether any of its
+ * buttons may have a configuration waiting, including parked ones.
+ */
+static volatile uint16_t BTN_ConfigSerial = 0;
+
+/**
+ * @brief Publishes a configuration for the next pass of a button.
+ *
+ * The configuration is completely written before the pointer store, and the
+ * pointer before the publish counter. The counter is shared by all buttons,
+ * which may be published from different contexts, so it is incremented with
+ * `BTN_ATOMIC_INCREMENT()`.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Config Pointer to the new configuration.
  *
  * @return None
  */
+static void ButtonConfigPublish(button_t *Key, const button_config_t *Config)
+{
+    BTN_MEMORY_BARRIER();
+    Key->ConfigNext = Config;
+    BTN_MEMORY_BARRIER();
+    BTN_ATOMIC_INCREMENT(BTN_ConfigSerial);
+}
 
-static void ButtonReleaseAfterRepeatRoutine(button_t *Key)
+/**
+ * @brief Switches a button to its published configuration.
+ *
+ * Runs in the context processing the button. Runtime state tied to a changed
+ * parameter is reset as the corresponding setter does for an in-place change.
+ * The previous configuration is compared before the pointer store, since the
+ * writer may reuse its buffer as soon as the store is visible.
+ *
+ * @param Key Pointer to the button structure.
+ *
+ * @return None
+ */
+static void ButtonConfigAdopt(button_t *Key)
 {
-    if (Key->ButtonReleaseAfterRepeat != NULL)
+    const button_config_t *Next = Key->ConfigNext;
+    const button_config_t *Prev = Key->Config;
+#if BTN_LEADING_EDGE
+    uint8_t EdgeChanged;
+#endif
+#if BTN_REPEAT_PROFILE
+    uint8_t ProfileChanged;
+#endif
+#if BTN_ADAPTIVE_DEBOUNCE
+    uint8_t BoundsChanged;
+#endif
+#if BTN_SAMPLE_DEBOUNCE
+    uint8_t SamplesChanged;
+#endif
+
+    if (Next == Prev)
     {
-        Key->ButtonReleaseAfterRepeat(Key->NumberBtn);
+        return;
     }
-    Key->State = IDLE;
+
+    BTN_MEMORY_BARRIER();
+#if BTN_LEADING_EDGE
+    EdgeChanged = (Next->LeadingEdge != Prev->LeadingEdge);
+#endif
+#if BTN_REPEAT_PROFILE
+    ProfileChanged =
+        (Next->RepeatProfile != Prev->RepeatProfile || Next->RepeatProfileCount != Prev->RepeatProfileCount);
+#endif
+#if BTN_ADAPTIVE_DEBOUNCE
+    BoundsChanged = (Next->DebounceMin != Prev->DebounceMin || Next->DebounceMax != Prev->DebounceMax);
+#endif
+#if BTN_SAMPLE_DEBOUNCE
+    SamplesChanged = (Next->DebounceSamples != Prev->DebounceSamples);
+#endif
+    BTN_MEMORY_BARRIER();
+    Key->Config = Next;
+
+#if BTN_LEADING_EDGE
+    if (EdgeChanged)
+    {
+        Key->Lockout = 0;
+    }
+#endif
+#if BTN_REPEAT_PROFILE
+    if (ProfileChanged)
+    {
+        Key->RepeatStage = 0;
+    }
+#endif
+#if BTN_ADAPTIVE_DEBOUNCE
+    if (BoundsChanged)
+    {
+        ButtonAdaptReset(Key);
+    }
+#endif
+#if BTN_SAMPLE_DEBOUNCE
+    if (SamplesChanged)
+    {
+        Key->SampleRun = 0;
+#if BTN_ADAPTIVE_DEBOUNCE
+        ButtonAdaptReset(Key);
+#endif
+    }
+#endif
 }
 #endif
 
-/* =================================== State machine
- * ================================== */
 /**
- * @brief Handles the button state machine and triggers appropriate routines
- * based on the button's current state.
+ * @brief Returns the configuration a setter has to modify.
  *
- * This function is responsible for managing the button state transitions and
- * calling the corresponding routine for each state (e.g., IDLE, DEBOUNCE,
- * PRESSED, REPEAT, RELEASE, RELEASE_AFTER_REPEAT). It should be invoked in the
- * main loop or the main system task to continuously check and process the
- * button's state.
+ * With `BTN_ATOMIC_CONFIG` and configuration buffers, this is a copy of the
+ * current configuration in the buffer the button is not using; otherwise the
+ * configuration itself.
  *
- * Actions performed:
- * - Evaluates the current button state (`State`) and calls the corresponding
- * state handling function:
- *   - `ButtonIdleRoutine` for the `IDLE` state.
- *   - `ButtonDebounceRoutine` for the `DEBOUNCE` state.
- *   - `ButtonPressedRoutine` for the `PRESSED` state.
- *   - `ButtonRepeatRoutine` for the `REPEAT` state.
- *   - `ButtonDebounceReleaseRoutine` for the `DEBOUNCE_RELEASE` state.
- *   - `ButtonReleaseRoutine` for the `RELEASE` state.
- *   - `ButtonReleaseAfterRepeatRoutine` for the `RELEASE_AFTER_REPEAT` state,
- * if enabled.
+ * @param Key Pointer to the button structure.
+ * @return Pointer to the configuration to modify, or NULL if the button is
+ * invalid or a published change has not been adopted yet.
+ */
+static button_config_t *ButtonConfigEdit(button_t *Key)
+{
+    if (Key == NULL || !BTN_CFG_VALID(Key))
+    {
+        return NULL;
+    }
+#if BTN_ATOMIC_CONFIG
+    if (Key->ConfigBuffers != NULL)
+    {
+        const button_config_t *Current = Key->Config;
+        button_config_t *Edit = (Current == &Key->ConfigBuffers[0]) ? &Key->ConfigBuffers[1] : &Key->ConfigBuffers[0];
+
+        if (Key->ConfigNext != Current)
+        {
+            return NULL;
+        }
+        *Edit = *Current;
+        return Edit;
+    }
+#endif
+    return BTN_CFG_RW(Key);
+}
+
+/**
+ * @brief Completes a change started with `ButtonConfigEdit()`.
  *
- * @param Key Pointer to the button structure being processed.
+ * Publishes an edited copy for the button's next pass; an in-place change is
+ * already complete.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Edit Configuration returned by `ButtonConfigEdit()`.
+ * @return Always `BTN_OK`.
+ */
+static BTN_operate_status ButtonConfigCommit(button_t *Key, button_config_t *Edit)
+{
+#if BTN_ATOMIC_CONFIG
+    if (!BTN_CFG_IN_PLACE(Key, Edit))
+    {
+        ButtonConfigPublish(Key, Edit);
+    }
+#else
+    (void)Key;
+    (void)Edit;
+#endif
+    return BTN_OK;
+}
+
+static void ButtonResetInstance(button_t *Key)
+{
+    memset(Key, 0, sizeof(button_t));
+}
+
+/**
+ * @brief Resets a button and initializes its runtime state.
+ *
+ * @param Key Pointer to the button structure to initialize.
+ * @param GpioPort GPIO port where the button is connected.
+ * @param GpioPin GPIO pin where the button is connected.
+ * @param Number Button identifier passed to callback functions.
+ *
+ * @return None
+ */
+static void ButtonInitRuntime(button_t *Key, BTN_GPIO_PORT_T *GpioPort, BTN_GPIO_PIN_T GpioPin, uint16_t Number)
+{
+    ButtonResetInstance(Key);
+    Key->State = IDLE;
+    Key->LastTick = BTN_GET_TICK;
+    Key->GpioPort = GpioPort;
+    Key->GpioPin = GpioPin;
+    Key->NumberBtn = Number;
+#if BTN_ADAPTIVE_DEBOUNCE
+    ButtonAdaptReset(Key);
+#endif
+#if BTN_STATS
+    ButtonStatsClear(Key);
+#endif
+}
+
+/* ========================== Initialization Functions =========================
+ */
+/**
+ * @brief Initializes a button configuration with the provided parameters.
+ *
+ * This function clears the configuration, sets the debounce, long press and
+ * repeat times and the reverse logic mode. The release debounce time is set to
+ * the press debounce time, multiple click handling and the non-used timer are
+ * disabled and all callbacks are cleared.
+ *
+ * @param Config Pointer to the configuration structure to initialize.
+ * @param TimerDebounce Debounce time in milliseconds to filter button noise.
+ * @param TimerLongPressed Time in milliseconds to detect a long press.
+ * @param TimerRepeat Time in milliseconds for repeated press events.
+ * @param ReverseLogic Indicates whether the GPIO uses reverse logic
+ * (active-low).
+ * @return Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if there was an error during initialization.
+ */
+BTN_operate_status ButtonConfigInit(button_config_t *Config, BTN_TIME_t TimerDebounce, BTN_TIME_t TimerLongPressed,
+                                    BTN_TIME_t TimerRepeat, ReverseLogicGpio_t ReverseLogic)
+{
+    if (Config == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    memset(Config, 0, sizeof(button_config_t));
+    Config->TimerDebounce = TimerDebounce;
+    Config->TimerLongPressed = TimerLongPressed;
+    Config->TimerRepeat = TimerRepeat;
+    Config->ReverseLogic = ReverseLogic;
+
+#if BTN_DOUBLE_DEBOUNCING
+    Config->TimerSecondDebounce = TimerDebounce;
+#endif
+
+#if BTN_MULTIPLE_CLICK
+    Config->MultipleClickMode = BTN_MULTIPLE_CLICK_OFF;
+#endif
+
+#if BTN_NON_USED_CALLBACK
+    Config->TimerNonUsed = 0;
+#endif
+    return BTN_OK;
+}
+
+/**
+ * @brief Initializes a button structure with an existing configuration.
+ *
+ * This function sets the initial state of the button, configures its associated
+ * GPIO port and pin and assigns a unique identifier. With `BTN_SHARED_CONFIG`
+ * enabled the button references `Config`, which may be `const` and shared by
+ * many buttons; otherwise `Config` is copied into the button.
+ *
+ * @param Key Pointer to the button structure to initialize.
+ * @param GpioPort GPIO port where the button is connected.
+ * @param GpioPin GPIO pin where the button is connected.
+ * @param Config Pointer to the button configuration.
+ * @param Number Button identifier passed to callback functions.
+ * @return Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if there was an error during initialization.
+ */
+BTN_operate_status ButtonInitKeyConfig(button_t *Key, BTN_GPIO_PORT_T *GpioPort, BTN_GPIO_PIN_T GpioPin,
+                                       const button_config_t *Config, uint16_t Number)
+{
+    if (Key == NULL || GpioPort == NULL || Config == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    ButtonInitRuntime(Key, GpioPort, GpioPin, Number);
+#if BTN_SHARED_CONFIG
+    Key->Config = Config;
+#if BTN_ATOMIC_CONFIG
+    Key->ConfigNext = Config;
+#endif
+#else
+    Key->Config = *Config;
+#endif
+    return BTN_OK;
+}
+
+/**
+ * @brief Initializes a button fed by an input source other than a GPIO pin.
+ *
+ * The button has no GPIO port; `GpioPin` holds its index in the input source
+ * (the bit of a `button_input_t` bitmap, the key of a `button_adc_t` ladder,
+ * ...). Such a button is processed by its input source through
+ * `ButtonFeedInput()`, not by `ButtonTask()`.
+ *
+ * @param Key Pointer to the button structure to initialize.
+ * @param Bit Index of the button in its input source.
+ * @param Config Pointer to the button configuration.
+ * @param Number Button identifier passed to callback functions.
+ * @return Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if an error occurs during initialization.
+ */
+BTN_operate_status ButtonInitKeyBit(button_t *Key, uint16_t Bit, const button_config_t *Config, uint16_t Number)
+{
+    if (Key == NULL || Config == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    ButtonInitRuntime(Key, NULL, (BTN_GPIO_PIN_T)Bit, Number);
+#if BTN_SHARED_CONFIG
+    Key->Config = Config;
+#if BTN_ATOMIC_CONFIG
+    Key->ConfigNext = Config;
+#endif
+#else
+    Key->Config = *Config;
+#endif
+    return BTN_OK;
+}
+
+#if BTN_ATOMIC_CONFIG
+/**
+ * @brief Gives a button two buffers for atomic reconfiguration.
+ *
+ * The setters then edit a copy of the current configuration in the buffer the
+ * button is not running on and publish it through `ConfigNext`; the button
+ * switches to it at the start of its next pass.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Buffers Array of two configurations, or NULL to modify the
+ * configuration in place.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonSetConfigBuffers(button_t *Key, button_config_t *Buffers)
+{
+    if (Key == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    Key->ConfigBuffers = Buffers;
+    return BTN_OK;
+}
+
+/**
+ * @brief Publishes a new configuration for a button.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Config Pointer to the new configuration.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the configuration was published.
+ *         - `BTN_ERROR` if a pointer is NULL or a previous change is still
+ *           pending.
+ */
+BTN_operate_status ButtonPublishConfig(button_t *Key, const button_config_t *Config)
+{
+    if (Key == NULL || Config == NULL || Key->ConfigNext != Key->Config)
+    {
+        return BTN_ERROR;
+    }
+
+    ButtonConfigPublish(Key, Config);
+    return BTN_OK;
+}
+
+/**
+ * @brief Checks whether a published configuration waits to be adopted.
+ *
+ * @param Key Pointer to the button structure.
+ * @return 1 while the button has not adopted the last published
+ * configuration, 0 otherwise.
+ */
+uint8_t ButtonConfigPending(const button_t *Key)
+{
+    return (Key != NULL && Key->ConfigNext != Key->Config) ? 1U : 0U;
+}
+#endif
+
+#if !BTN_SHARED_CONFIG
+/**
+ * @brief Initializes a button structure with the provided parameters.
+ *
+ * This function sets the initial state of the button, configures its associated
+ * GPIO port and pin, and initializes timers for debounce, long press, and
+ * repeat events. It also sets the button's reverse logic mode and assigns a
+ * unique identifier.
+ *
+ * @param Key Pointer to the button structure to initialize.
+ * @param GpioPort GPIO port where the button is connected.
+ * @param GpioPin GPIO pin where the button is connected.
+ * @param TimerDebounce Debounce time in milliseconds to filter button noise.
+ * @param TimerLongPressed Time in milliseconds to detect a long press.
+ * @param TimerRepeat Time in milliseconds for repeated press events.
+ * @param ReverseLogic Indicates whether the GPIO uses reverse logic
+ * (active-low).
+ * @param Number Button identifier passed to callback functions.
+ * @return Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if there was an error during initialization.
+ */
+BTN_operate_status ButtonInitKey(button_t *Key, BTN_GPIO_PORT_T *GpioPort, BTN_GPIO_PIN_T GpioPin,
+                                 BTN_TIME_t TimerDebounce, BTN_TIME_t TimerLongPressed, BTN_TIME_t TimerRepeat,
+                                 ReverseLogicGpio_t ReverseLogic, uint16_t Number)
+{
+    if (Key == NULL || GpioPort == NULL)
+    {
+        return BTN_ERROR;
+    }
+    ButtonInitRuntime(Key, GpioPort, GpioPin, Number);
+    return ButtonConfigInit(&Key->Config, TimerDebounce, TimerLongPressed, TimerRepeat, ReverseLogic);
+}
+
+#if BTN_DEFAULT_INIT
+/**
+ * @brief Initializes a button structure with default timing values.
+ *
+ * This function sets the initial state of the button, configures its associated
+ * GPIO port and pin, and initializes timers for debounce, long press, and
+ * repeat events using predefined default values. It also sets the button's
+ * reverse logic mode and assigns a unique identifier.
+ *
+ * Default timing values:
+ * - Debounce time: `BTN_DEFAULT_TIME_DEBOUNCE`
+ * - Long press time: `BTN_DEFAULT_TIME_LONG_PRESS`
+ * - Repeat time: `BTN_DEFAULT_TIME_REPEAT`
+ *
+ * @param Key Pointer to the button structure to initialize.
+ * @param GpioPort GPIO port where the button is connected.
+ * @param GpioPin GPIO pin where the button is connected.
+ * @param ReverseLogic Indicates whether the GPIO uses reverse logic
+ * (active-low).
+ * @param Number Button identifier passed to callback functions.
+ * @return Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if there was an error during initialization.
+ */
+BTN_operate_status ButtonInitKeyDefault(button_t *Key, BTN_GPIO_PORT_T *GpioPort, BTN_GPIO_PIN_T GpioPin,
+                                        ReverseLogicGpio_t ReverseLogic, uint16_t Number)
+{
+    return ButtonInitKey(Key, GpioPort, GpioPin, BTN_DEFAULT_TIME_DEBOUNCE, BTN_DEFAULT_TIME_LONG_PRESS,
+                         BTN_DEFAULT_TIME_REPEAT, ReverseLogic, Number);
+}
+#endif
+#endif
+
+#if BTN_MULTIPLE_CLICK
+/**
+ * @brief Sets the multiple click mode and the timer between clicks for the
+ * button.
+ *
+ * This function configures the button to operate in different multiple click
+ * modes, such as normal or combined, and sets the time between consecutive
+ * clicks.
+ *
+ * @param Key Pointer to the button structure.
+ * @param MultipleClickMode The mode to handle multiple clicks (e.g.,
+ * BTN_MULTIPLE_CLICK_OFF, BTN_MULTIPLE_CLICK_NORMAL_MODE).
+ * @param TimerBetweenClick Time in milliseconds between two clicks that are
+ * considered part of the same multiple click event.
+ * @return Status of the configuration:
+ *         - `BTN_OK` if the configuration was successful.
+ *         - `BTN_ERROR` if there was an error during configuration.
+ */
+BTN_operate_status ButtonSetMultipleClick(button_t *Key, MultipleClickMode_t MultipleClickMode,
+                                          BTN_TIME_t TimerBetweenClick)
+{
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    Config->MultipleClickMode = MultipleClickMode;
+    Config->TimerBetweenClick = TimerBetweenClick;
+    return ButtonConfigCommit(Key, Config);
+}
+
+/**
+ * @brief Sets the longest click sequence of a button in combined mode.
+ *
+ * A non-zero `MaxClicks` enables N-click detection: click sequences up to
+ * `MaxClicks` clicks are counted and delivered as `BTN_EVENT_CLICK_COUNT`
+ * (or as press / double / triple click without a click count receiver). A
+ * sequence is delivered as soon as it reaches `MaxClicks` or no longer
+ * sequence has a receiver, without waiting for `TimerBetweenClick` to pass.
+ *
+ * @param Key Pointer to the button structure.
+ * @param MaxClicks Longest click sequence (1 to `BTN_MAX_CLICKS`), or 0 for the
+ * classic behaviour limited to triple clicks.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonSetMaxClicks(button_t *Key, uint8_t MaxClicks)
+{
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL || MaxClicks > BTN_MAX_CLICKS)
+    {
+        return BTN_ERROR;
+    }
+
+    Config->MaxClicks = MaxClicks;
+    return ButtonConfigCommit(Key, Config);
+}
+#endif
+
+#if BTN_NON_USED_CALLBACK
+/**
+ * @brief Configures the non-used (idle) behavior for a button.
+ *
+ * This function sets the time threshold for considering a button as unused and
+ * assigns a callback function to be executed when the button remains idle for
+ * the specified duration.
+ *
+ * @param Key Pointer to the button instance.
+ * @param Miliseconds Time in milliseconds after which the button is considered
+ * non-used. If set to 0, the non-used functionality is disabled for this
+ * button.
+ * @param Callback Pointer to the function to be executed when the button is
+ * unused. Ignored in `BTN_EVENT_HANDLER` mode, where the event is delivered to
+ * the event handler as `BTN_EVENT_NON_USED`.
+ * @return Status of the configuration:
+ *         - `BTN_OK` if the configuration was successful.
+ *         - `BTN_ERROR` if there was an error during configuration.
+ *
+ * @note Ensure that the `BTN_NON_USED_CALLBACK` macro is enabled in the library
+ * configuration to use this functionality.
+ */
+BTN_operate_status ButtonSetNonUsed(button_t *Key, BTN_TIME_t Miliseconds, void *Callback)
+{
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    Config->TimerNonUsed = Miliseconds;
+#if BTN_EVENT_HANDLER
+    (void)Callback;
+#else
+    Config->ButtonNonUsed = Callback;
+#endif
+    return ButtonConfigCommit(Key, Config);
+}
+#endif
+
+/* ========================== Button State Handlers ==========================
+ */
+#if BTN_ADAPTIVE_DEBOUNCE
+/**
+ * @brief Returns the adaptive debounce window for a learnt settling time.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Learnt Learnt settling time.
+ * @return `Learnt + BTN_ADAPTIVE_DEBOUNCE_MARGIN`, limited to the button's
+ * `DebounceMin` / `DebounceMax` bounds.
+ */
+static BTN_TIME_t ButtonAdaptWindow(const button_t *Key, BTN_TIME_t Learnt)
+{
+    BTN_TIME_t Max = BTN_CFG(Key)->DebounceMax;
+    BTN_TIME_t Window;
+
+    if (Learnt >= Max || (BTN_TIME_t)(Max - Learnt) <= BTN_ADAPTIVE_DEBOUNCE_MARGIN)
+    {
+        Window = Max;
+    }
+    else
+    {
+        Window = (BTN_TIME_t)(Learnt + BTN_ADAPTIVE_DEBOUNCE_MARGIN);
+    }
+    if (Window < BTN_CFG(Key)->DebounceMin)
+    {
+        Window = BTN_CFG(Key)->DebounceMin;
+    }
+    return Window;
+}
+
+/**
+ * @brief Starts a settling time measurement.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Active Input level at the start of the debounce.
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonAdaptBegin(button_t *Key, uint8_t Active, BTN_TIME_t Now)
+{
+    Key->AdaptEdge = Now;
+    Key->AdaptActive = Active;
+}
+
+/**
+ * @brief Records the tick of an input change during a debounce.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Active Logical pressed state of the button in this pass.
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonAdaptTrack(button_t *Key, uint8_t Active, BTN_TIME_t Now)
+{
+    if ((Active != 0U) != Key->AdaptActive)
+    {
+        Key->AdaptEdge = Now;
+        Key->AdaptActive = (Active != 0U);
+    }
+}
+
+/**
+ * @brief Updates a learnt settling time with a new measurement.
+ *
+ * A measurement above the learnt time is adopted at once, a lower one only
+ * pulls the learnt time down by 1/2^`BTN_ADAPTIVE_DEBOUNCE_DECAY` of the
+ * difference.
+ *
+ * @param Learnt Pointer to the learnt settling time.
+ * @param Settle Measured settling time.
+ * @param Window Debounce window the measurement was taken with.
+ *
+ * @return None
+ */
+static void ButtonAdaptLearn(BTN_TIME_t *Learnt, BTN_TIME_t Settle, BTN_TIME_t Window)
+{
+    if (*Learnt > Window)
+    {
+        *Learnt = Window;
+    }
+    if (Settle >= *Learnt)
+    {
+        *Learnt = Settle;
+    }
+    else
+    {
+        BTN_TIME_t Step = (BTN_TIME_t)((BTN_TIME_t)(*Learnt - Settle) >> BTN_ADAPTIVE_DEBOUNCE_DECAY);
+
+        *Learnt = (BTN_TIME_t)(*Learnt - ((Step != 0U) ? Step : 1U));
+    }
+}
+#endif
+
+/**
+ * @brief Returns the press debounce window of a button.
+ *
+ * @param Key Pointer to the button structure.
+ * @return 0 in sample count mode (`BTN_SAMPLE_DEBOUNCE`), the adaptive window
+ * if `BTN_ADAPTIVE_DEBOUNCE` bounds are set, `TimerDebounce` otherwise.
+ */
+static BTN_TIME_t ButtonDebounceTime(const button_t *Key)
+{
+#if BTN_SAMPLE_DEBOUNCE
+    if (BTN_CFG(Key)->DebounceSamples != 0U)
+    {
+        return 0;
+    }
+#endif
+#if BTN_ADAPTIVE_DEBOUNCE
+    if (BTN_CFG(Key)->DebounceMax != 0U)
+    {
+        return ButtonAdaptWindow(Key, Key->AdaptPress);
+    }
+#endif
+    return BTN_CFG(Key)->TimerDebounce;
+}
+
+#if BTN_DOUBLE_DEBOUNCING
+/**
+ * @brief Returns the release debounce window of a button.
+ *
+ * @param Key Pointer to the button structure.
+ * @return 0 in sample count mode (`BTN_SAMPLE_DEBOUNCE`), the adaptive window
+ * if `BTN_ADAPTIVE_DEBOUNCE` bounds are set, `TimerSecondDebounce` otherwise.
+ */
+static BTN_TIME_t ButtonReleaseDebounceTime(const button_t *Key)
+{
+#if BTN_SAMPLE_DEBOUNCE
+    if (BTN_CFG(Key)->DebounceSamples != 0U)
+    {
+        return 0;
+    }
+#endif
+#if BTN_ADAPTIVE_DEBOUNCE
+    if (BTN_CFG(Key)->DebounceMax != 0U)
+    {
+        return ButtonAdaptWindow(Key, Key->AdaptRelease);
+    }
+#endif
+    return BTN_CFG(Key)->TimerSecondDebounce;
+}
+#endif
+
+#if BTN_ADAPTIVE_DEBOUNCE && BTN_DOUBLE_DEBOUNCING
+/**
+ * @brief Learns from a release that turned out to be a glitch while held.
+ *
+ * The press bounce outlasted its window, so the learnt press settling time is
+ * raised to twice the current window.
+ *
+ * @param Key Pointer to the button structure being processed.
+ *
+ * @return None
+ */
+static void ButtonAdaptGlitch(button_t *Key)
+{
+    BTN_TIME_t Press = ButtonDebounceTime(Key);
+
+    ButtonAdaptLearn(&Key->AdaptPress, (Press > BTN_MAX_TIMEOUT / 2U) ? BTN_MAX_TIMEOUT : (BTN_TIME_t)(2U * Press),
+                     Press);
+}
+#endif
+
+#if BTN_SAMPLE_DEBOUNCE
+/**
+ * @brief Starts counting identical samples after an input edge.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Active Input level after the edge.
+ *
+ * @return None
+ */
+static void ButtonSampleBegin(button_t *Key, uint8_t Active)
+{
+    Key->SampleLevel = Active;
+    Key->SampleRun = 0;
+}
+#endif
+
+/**
+ * @brief Checks whether a debounce in `DEBOUNCE` or `DEBOUNCE_RELEASE` has
+ * settled.
+ *
+ * In sample count mode (`DebounceSamples` set) the input has settled once the
+ * last `DebounceSamples` passes sampled the same level; any change restarts the
+ * count. Otherwise it has settled once `Window` ticks have passed since
+ * `Since`, and the level sampled in this pass decides.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Active Logical pressed state of the button in this pass.
+ * @param Since Tick at which the debounce started.
+ * @param Window Debounce window of the time based mode.
+ * @param Now Tick of the current pass.
+ * @return 1 if the debounce has settled on `Active`, 0 otherwise.
+ */
+static uint8_t ButtonDebounceSettled(button_t *Key, uint8_t Active, BTN_TIME_t Since, BTN_TIME_t Window,
+                                     BTN_TIME_t Now)
+{
+#if BTN_SAMPLE_DEBOUNCE
+    if (BTN_CFG(Key)->DebounceSamples != 0U)
+    {
+        if ((Active != 0U) != Key->SampleLevel)
+        {
+            ButtonSampleBegin(Key, (Active != 0U));
+        }
+        if (Key->SampleRun < BTN_SAMPLE_DEBOUNCE_MAX)
+        {
+            Key->SampleRun++;
+        }
+        return Key->SampleRun >= BTN_CFG(Key)->DebounceSamples;
+    }
+#else
+    (void)Key;
+    (void)Active;
+#endif
+    return BTN_ELAPSED(Now, Since) >= Window;
+}
+
+/**
+ * @brief Checks whether a button fires its press on the leading edge.
+ *
+ * @param Key Pointer to the button structure.
+ * @return 1 in leading edge mode (`BTN_LEADING_EDGE`), 0 otherwise.
+ */
+static uint8_t ButtonLeadingEdge(const button_t *Key)
+{
+#if BTN_LEADING_EDGE
+    return BTN_CFG(Key)->LeadingEdge;
+#else
+    (void)Key;
+    return 0;
+#endif
+}
+
+#if BTN_LEADING_EDGE
+/**
+ * @brief Starts the edge lockout of a leading edge button.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Now Tick of the accepted press or release.
+ *
+ * @return None
+ */
+static void ButtonLockoutBegin(button_t *Key, BTN_TIME_t Now)
+{
+    if (BTN_CFG(Key)->LeadingEdge)
+    {
+        Key->Lockout = 1;
+        Key->LockoutTick = Now;
+    }
+}
+
+/**
+ * @brief Returns the time left in the edge lockout of a button.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Now Tick of the current pass.
+ * @return Ticks until the lockout ends, 0 if the button is not locked out.
+ */
+static BTN_TIME_t ButtonLockoutLeft(const button_t *Key, BTN_TIME_t Now)
+{
+    BTN_TIME_t Elapsed;
+
+    if (!Key->Lockout)
+    {
+        return 0;
+    }
+    Elapsed = BTN_ELAPSED(Now, Key->LockoutTick);
+    return (Elapsed >= BTN_CFG(Key)->TimerDebounce) ? 0 : (BTN_TIME_t)(BTN_CFG(Key)->TimerDebounce - Elapsed);
+}
+
+/**
+ * @brief Checks whether input edges of a button are currently ignored.
+ *
+ * Ends an expired lockout.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Now Tick of the current pass.
+ * @return 1 while the lockout after a leading edge press or a release runs,
+ * 0 otherwise.
+ */
+static uint8_t ButtonLockedOut(button_t *Key, BTN_TIME_t Now)
+{
+    if (ButtonLockoutLeft(Key, Now) == 0U)
+    {
+        Key->Lockout = 0;
+    }
+    return Key->Lockout;
+}
+#endif
+
+/**
+ * @brief Starts debouncing a press of an idle button.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonDebounceBegin(button_t *Key, BTN_TIME_t Now)
+{
+    Key->LastTick = Now;
+    Key->State = DEBOUNCE;
+#if BTN_ADAPTIVE_DEBOUNCE
+    ButtonAdaptBegin(Key, 1, Now);
+#endif
+#if BTN_SAMPLE_DEBOUNCE
+    ButtonSampleBegin(Key, 1);
+#endif
+}
+
+/**
+ * @brief Accepts a debounced press of the button.
+ *
+ * Transitions the button to `PRESSED`, updates the timestamps and triggers the
+ * press handling: `MultipleClickDebounce` if multiple click handling is enabled
+ * (`BTN_MULTIPLE_CLICK`), or the single press callback (`ButtonPressed`)
+ * otherwise.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonPressAccept(button_t *Key, BTN_TIME_t Now)
+{
+#if BTN_STATS
+    Key->StatsPressTick = Now;
+#endif
+#if BTN_EVENT_PRESS_INFO
+    Key->PressTime = Now;
+    Key->RepeatCount = 0;
+#endif
+#if BTN_LEADING_EDGE
+    ButtonLockoutBegin(Key, Now);
+#endif
+#if BTN_MULTIPLE_CLICK
+    MultipleClickDebounce(Key, Now);
+    Key->State = PRESSED;
+    Key->LastClickTick = Now;
+#else
+    Key->State = PRESSED;
+    Key->LastTick = Now;
+    ButtonEmit(Key, BTN_EVENT_PRESSED, Now);
+#endif
+}
+
+/**
+ * @brief Records an accepted release: the press duration (`BTN_STATS`,
+ * `BTN_EVENT_PRESS_INFO`) and the start of the edge lockout
+ * (`BTN_LEADING_EDGE`).
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonReleaseRecord(button_t *Key, BTN_TIME_t Now)
+{
+#if BTN_STATS
+    ButtonStatsPress(Key, Now);
+#endif
+#if BTN_LEADING_EDGE
+    ButtonLockoutBegin(Key, Now);
+#endif
+#if BTN_EVENT_PRESS_INFO
+    Key->PressTime = BTN_ELAPSED(Now, Key->PressTime);
+#endif
+#if !BTN_STATS && !BTN_LEADING_EDGE && !BTN_EVENT_PRESS_INFO
+    (void)Key;
+    (void)Now;
+#endif
+}
+
+#if BTN_DOUBLE_DEBOUNCING
+/**
+ * @brief Starts debouncing the release of a button in `PRESSED` or `REPEAT`.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonReleaseDebounceBegin(button_t *Key, BTN_TIME_t Now)
+{
+    Key->StateBeforeRelease = Key->State;
+    Key->State = DEBOUNCE_RELEASE;
+    Key->LastTickSecondDebounce = Now;
+#if BTN_ADAPTIVE_DEBOUNCE
+    ButtonAdaptBegin(Key, 0, Now);
+#endif
+#if BTN_SAMPLE_DEBOUNCE
+    ButtonSampleBegin(Key, 0);
+#endif
+}
+#endif
+
+#if !BTN_TABLE_CORE
+/**
+ * @brief Accepts a debounced release of a button leaving `PRESSED` or `REPEAT`.
+ *
+ * Transitions the button to `RELEASE_AFTER_REPEAT` after a repeat (if
+ * `BTN_RELEASE_AFTER_REPEAT` is enabled) or to `RELEASE` otherwise, and records
+ * the release through `ButtonReleaseRecord`.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param StateBeforeRelease The state the button was in while held.
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonReleaseAccept(button_t *Key, ButtonState_t StateBeforeRelease, BTN_TIME_t Now)
+{
+    ButtonReleaseRecord(Key, Now);
+#if BTN_RELEASE_AFTER_REPEAT
+    if (StateBeforeRelease == REPEAT)
+    {
+        Key->State = RELEASE_AFTER_REPEAT;
+        return;
+    }
+#else
+    (void)StateBeforeRelease;
+#endif
+    Key->State = RELEASE;
+}
+
+/**
+ * @brief Starts the release handling of a button in `PRESSED` or `REPEAT`.
+ *
+ * With `BTN_DOUBLE_DEBOUNCING` enabled the button enters `DEBOUNCE_RELEASE`,
+ * unless the input is already debounced; otherwise it goes straight to the
+ * release state through `ButtonReleaseAccept`.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Debounced Non-zero if the release comes from an already debounced
+ * source.
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonReleaseBegin(button_t *Key, uint8_t Debounced, BTN_TIME_t Now)
+{
+#if BTN_DOUBLE_DEBOUNCING
+    if (!Debounced)
+    {
+        ButtonReleaseDebounceBegin(Key, Now);
+        return;
+    }
+#else
+    (void)Debounced;
+#endif
+    ButtonReleaseAccept(Key, Key->State, Now);
+}
+#endif
+
+/**
+ * @brief Accepts a long press: the button enters `REPEAT` and the long press
+ * event is delivered.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonLongPressAccept(button_t *Key, BTN_TIME_t Now)
+{
+    Key->State = REPEAT;
+    Key->LastTick = Now;
+#if BTN_REPEAT_PROFILE || BTN_EVENT_PRESS_INFO
+    Key->RepeatCount = 0;
+#endif
+#if BTN_REPEAT_PROFILE
+    Key->RepeatStage = 0;
+#endif
+    ButtonEmit(Key, BTN_EVENT_LONG_PRESSED, Now);
+}
+
+/**
+ * @brief Returns the time between two repeats of a button in `REPEAT`.
+ *
+ * @param Key Pointer to the button structure.
+ * @return The interval of the current repeat profile stage with
+ * `BTN_REPEAT_PROFILE`, `TimerRepeat` otherwise.
+ */
+static BTN_TIME_t ButtonRepeatPeriod(const button_t *Key)
+{
+#if BTN_REPEAT_PROFILE
+    return ButtonRepeatTime(Key);
+#else
+    return BTN_CFG(Key)->TimerRepeat;
+#endif
+}
+
+/**
+ * @brief Delivers the next repeat of a held button.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonRepeatFire(button_t *Key, BTN_TIME_t Now)
+{
+    Key->LastTick = Now;
+#if BTN_REPEAT_PROFILE
+    ButtonRepeatAdvance(Key);
+#elif BTN_EVENT_PRESS_INFO
+    if (Key->RepeatCount != UINT16_MAX)
+    {
+        Key->RepeatCount++;
+    }
+#endif
+    ButtonEmit(Key, BTN_EVENT_REPEAT, Now);
+}
+
+#if !BTN_TABLE_CORE
+/**
+ * @brief Handles the idle state of the button.
+ *
+ * This function processes the button's behavior when it is in the idle state.
+ * It checks for a button press event, transitions the button state to debounce
+ * if a press is detected, and handles any multiple click logic if enabled.
+ *
+ * Actions performed:
+ * - Invokes the `multipleClikIdle` function if multiple click handling is
+ * enabled (`BTN_MULTIPLE_CLICK`).
+ * - Checks the pressed state sampled for this pass.
+ * - If a press is detected, updates the `LastTick` timestamp and transitions
+ * the button state to `DEBOUNCE`, or accepts the press right away if the input
+ * is already debounced.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Active Logical pressed state of the button in this pass.
+ * @param Debounced Non-zero if `Active` comes from an already debounced source.
+ * @param Now Tick of the current pass.
+ *
+ * @note This function is static and part of the internal state machine for
+ * button handling.
+ *
+ * @return None
+ */
+static void ButtonIdleRoutine(button_t *Key, uint8_t Active, uint8_t Debounced, BTN_TIME_t Now)
+{
+#if BTN_MULTIPLE_CLICK
+    multipleClikIdle(Key, Now);
+#endif
+#if BTN_LEADING_EDGE
+    if (ButtonLockedOut(Key, Now))
+    {
+        Active = 0;
+    }
+#endif
+    if (Active)
+    {
+        ButtonDebounceBegin(Key, Now);
+        if (Debounced || ButtonLeadingEdge(Key))
+        {
+            ButtonPressAccept(Key, Now);
+        }
+    }
+#if BTN_NON_USED_CALLBACK
+    if (BTN_CFG(Key)->TimerNonUsed && (BTN_ELAPSED(Now, Key->LastTick) >= BTN_CFG(Key)->TimerNonUsed))
+    {
+        Key->LastTick = Now;
+        ButtonEmit(Key, BTN_EVENT_NON_USED, Now);
+    }
+#endif
+}
+
+/**
+ * @brief Handles the debounce state of the button.
+ *
+ * This function processes the button's behavior during the debounce state. It
+ * verifies if the debounce timer has elapsed and determines whether the button
+ * press is valid based on the GPIO pin state. Depending on the configuration,
+ * it transitions the state to `PRESSED` or back to `IDLE` and triggers the
+ * appropriate callbacks if required.
+ *
+ * Actions performed:
+ * - Checks if the debounce timer (`TimerDebounce`) has elapsed.
+ * - Checks the pressed state sampled for this pass.
+ * - If a valid press is detected:
+ *   - Handles multiple clicks if enabled (`BTN_MULTIPLE_CLICK`) by invoking
+ * `MultipleClickDebounce`.
+ *   - Updates timestamps (`LastTick` or `LastClickTick`) and transitions the
+ * state to `PRESSED`.
+ *   - Executes the single press callback (`ButtonPressed`) if multiple click
+ * handling is disabled.
+ * - If no press is detected, transitions the state back to `IDLE`.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Active Logical pressed state of the button in this pass.
+ * @param Debounced Unused; the debounce state is skipped for debounced inputs.
+ * @param Now Tick of the current pass.
+ *
+ * @note This function is static and part of the internal state machine for
+ * button handling. Multiple click handling is only processed if
+ * `BTN_MULTIPLE_CLICK` is enabled.
+ *
+ * @return None
+ */
+static void ButtonDebounceRoutine(button_t *Key, uint8_t Active, uint8_t Debounced, BTN_TIME_t Now)
+{
+    BTN_TIME_t Window = ButtonDebounceTime(Key);
+
+    (void)Debounced;
+
+    if (Active && ButtonLeadingEdge(Key))
+    {
+        ButtonPressAccept(Key, Now);
+        return;
+    }
+#if BTN_ADAPTIVE_DEBOUNCE
+    ButtonAdaptTrack(Key, Active, Now);
+#endif
+    if (ButtonDebounceSettled(Key, Active, Key->LastTick, Window, Now))
+    {
+        if (Active)
+        {
+#if BTN_ADAPTIVE_DEBOUNCE
+            ButtonAdaptLearn(&Key->AdaptPress, BTN_ELAPSED(Key->AdaptEdge, Key->LastTick), Window);
+#endif
+            ButtonPressAccept(Key, Now);
+        }
+        else
+        {
+            Key->State = IDLE;
+#if BTN_STATS
+            ButtonStatsCount(&Key->Stats.DebounceAborts);
+#endif
+        }
+    }
+}
+
+/**
+ * @brief Handles the pressed state of the button.
+ *
+ * This function processes the button's behavior during the pressed state. It
+ * checks for either a release event or the expiration of the long press timer.
+ * Based on the conditions, it transitions the button state to `RELEASE` or
+ * `REPEAT` and triggers the long press callback if applicable.
+ *
+ * Actions performed:
+ * - Checks if the button is released (based on the sampled pressed state).
+ *   - If released, transitions the state to `RELEASE`.
+ * - Checks if the long press timer (`TimerLongPressed`) has elapsed.
+ *   - If elapsed, transitions the state to `REPEAT`, updates the `LastTick`
+ * timestamp, and invokes the long press callback (`ButtonLongPressed`) if it is
+ * set.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Active Logical pressed state of the button in this pass.
+ * @param Debounced Non-zero if `Active` comes from an already debounced source.
+ * @param Now Tick of the current pass.
+ *
+ * @note This function is static and part of the internal state machine for
+ * button handling.
+ *
+ * @return None
+ */
+
+static void ButtonPressedRoutine(button_t *Key, uint8_t Active, uint8_t Debounced, BTN_TIME_t Now)
+{
+    if (!Active)
+    {
+#if BTN_LEADING_EDGE
+        if (ButtonLockedOut(Key, Now))
+        {
+            return;
+        }
+#endif
+        ButtonReleaseBegin(Key, Debounced, Now);
+    }
+    else if (BTN_ELAPSED(Now, Key->LastTick) >= BTN_CFG(Key)->TimerLongPressed)
+    {
+        ButtonLongPressAccept(Key, Now);
+    }
+}
+
+/**
+ * @brief Handles the repeat state of the button.
+ *
+ * This function processes the button's behavior during the repeat state. It
+ * checks for the button release or long press expiration, and handles the
+ * repeat callback if the repeat timer has elapsed. Additionally, it handles
+ * multiple click logic if enabled.
+ *
+ * Actions performed:
+ * - Invokes the `multipleClikRepeat` function if multiple click handling is
+ * enabled (`BTN_MULTIPLE_CLICK`).
+ * - Checks if the button is released (based on the sampled pressed state).
+ *   - If released, transitions the state to either `RELEASE` or
+ * `RELEASE_AFTER_REPEAT` based on the configuration.
+ * - Checks if the repeat timer (`TimerRepeat`) has elapsed.
+ *   - If elapsed, updates the `LastTick` timestamp and invokes the repeat
+ * callback (`ButtonRepeat`) if set.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Active Logical pressed state of the button in this pass.
+ * @param Debounced Non-zero if `Active` comes from an already debounced source.
+ * @param Now Tick of the current pass.
+ *
+ * @note This function is static and part of the internal state machine for
+ * button handling. Multiple click handling is only processed if
+ * `BTN_MULTIPLE_CLICK` is enabled.
+ *
+ * @return None
+ */
+
+static void ButtonRepeatRoutine(button_t *Key, uint8_t Active, uint8_t Debounced, BTN_TIME_t Now)
+{
+#if BTN_MULTIPLE_CLICK
+    multipleClikRepeat(Key, Now);
+#endif
+    if (!Active)
+    {
+        ButtonReleaseBegin(Key, Debounced, Now);
+    }
+    else if (BTN_ELAPSED(Now, Key->LastTick) >= ButtonRepeatPeriod(Key))
+    {
+        ButtonRepeatFire(Key, Now);
+    }
+}
+
+#if BTN_DOUBLE_DEBOUNCING
+/**
+ * @brief Handles the debounce logic for the button release state.
+ *
+ * This routine checks if the button is stable (debounced) after being released.
+ * It determines the next state of the button based on its previous state
+ * (`StateBeforeRelease`) and the pressed state sampled for this pass.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Active Logical pressed state of the button in this pass.
+ * @param Debounced Unused; the debounce state is skipped for debounced inputs.
+ * @param Now Tick of the current pass.
+ */
+static void ButtonDebounceReleaseRoutine(button_t *Key, uint8_t Active, uint8_t Debounced, BTN_TIME_t Now)
+{
+    BTN_TIME_t Window = ButtonReleaseDebounceTime(Key);
+
+    (void)Debounced;
+
+#if BTN_ADAPTIVE_DEBOUNCE
+    ButtonAdaptTrack(Key, Active, Now);
+#endif
+    if (ButtonDebounceSettled(Key, Active, Key->LastTickSecondDebounce, Window, Now))
+    {
+        if (Active)
+        {
+#if BTN_ADAPTIVE_DEBOUNCE
+            ButtonAdaptGlitch(Key);
+#endif
+            Key->State = Key->StateBeforeRelease;
+        }
+        else
+        {
+#if BTN_ADAPTIVE_DEBOUNCE
+            ButtonAdaptLearn(&Key->AdaptRelease, BTN_ELAPSED(Key->AdaptEdge, Key->LastTickSecondDebounce), Window);
+#endif
+            ButtonReleaseAccept(Key, Key->StateBeforeRelease, Now);
+        }
+    }
+}
+#endif
+
+/**
+ * @brief Handles the release state of the button.
+ *
+ * This function processes the button's behavior during the release state. It
+ * triggers the release callback if defined and transitions the button state
+ * back to `IDLE`.
+ *
+ * Actions performed:
+ * - Invokes the release callback (`ButtonRelease`) if set, passing the button
+ * number as an argument.
+ * - Transitions the button state to `IDLE` after handling the release.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Active Unused; the release is already accepted.
+ * @param Debounced Unused.
+ * @param Now Tick of the current pass.
+ *
+ * @note This function is static and part of the internal state machine for
+ * button handling.
+ *
+ * @return None
+ */
+
+static void ButtonReleaseRoutine(button_t *Key, uint8_t Active, uint8_t Debounced, BTN_TIME_t Now)
+{
+    (void)Active;
+    (void)Debounced;
+    ButtonEmit(Key, BTN_EVENT_RELEASE, Now);
+    Key->State = IDLE;
+}
+
+#if BTN_RELEASE_AFTER_REPEAT
+/**
+ * @brief Handles the release state after repeat for the button.
+ *
+ * This function processes the button's behavior after a repeat cycle has
+ * completed. It triggers the release callback for this state if defined and
+ * transitions the button state back to `IDLE`.
+ *
+ * Actions performed:
+ * - Invokes the release after repeat callback (`ButtonReleaseAfterRepeat`) if
+ * set, passing the button number as an argument.
+ * - Transitions the button state to `IDLE` after handling the release.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Active Unused; the release is already accepted.
+ * @param Debounced Unused.
+ * @param Now Tick of the current pass.
+ *
+ * @note This function is static and part of the internal state machine for
+ * button handling, specifically for the state after repeat when
+ * `BTN_RELEASE_AFTER_REPEAT` is enabled.
+ *
+ * @return None
+ */
+
+static void ButtonReleaseAfterRepeatRoutine(button_t *Key, uint8_t Active, uint8_t Debounced, BTN_TIME_t Now)
+{
+    (void)Active;
+    (void)Debounced;
+    ButtonEmit(Key, BTN_EVENT_RELEASE_AFTER_REPEAT, Now);
+    Key->State = IDLE;
+}
+#endif
+#endif
+
+/* ================================ Timer deadlines
+ * ================================ */
+/**
+ * @brief Returns the time left until a timer started at `Since` expires.
+ *
+ * @param Since Timestamp at which the timer was started.
+ * @param Period Timer period.
+ * @param Now Current tick.
+ * @return Remaining ticks, 0 if the timer has already expired.
+ */
+static BTN_TIME_t ButtonTimeLeft(BTN_TIME_t Since, BTN_TIME_t Period, BTN_TIME_t Now)
+{
+    BTN_TIME_t Elapsed = BTN_ELAPSED(Now, Since);
+
+    return (Elapsed >= Period) ? 0 : (BTN_TIME_t)(Period - Elapsed);
+}
+
+/**
+ * @brief Computes the time until the button's state machine can next change
+ * without a new input edge.
+ *
+ * The deadline follows the timer the current state waits for:
+ * - `IDLE`: the end of a pending combined multiple click window
+ * (`TimerBetweenClick`), the non-used timeout (`TimerNonUsed`) and the end
+ * of a leading edge lockout.
+ * - `DEBOUNCE`: the debounce expiry (`TimerDebounce`).
+ * - `PRESSED`: the long press threshold (`TimerLongPressed`) and the end of a
+ * leading edge lockout.
+ * - `REPEAT`: the next repeat (`TimerRepeat` or the repeat profile interval),
+ * or immediately while the press event of the repeat cycle is still pending.
+ * - `DEBOUNCE_RELEASE`: the release debounce expiry (`TimerSecondDebounce`).
+ * - `RELEASE` / `RELEASE_AFTER_REPEAT`: immediately.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Now Current tick.
+ * @return Ticks until the next deadline, or `BTN_MAX_TIMEOUT` if there is
+ * none.
+ */
+static BTN_TIME_t ButtonTimeToDeadline(const button_t *Key, BTN_TIME_t Now)
+{
+    BTN_TIME_t Left = BTN_MAX_TIMEOUT;
+#if BTN_LEADING_EDGE
+    BTN_TIME_t Lockout;
+#endif
+
+    switch (Key->State)
+    {
+    case IDLE:
+#if BTN_MULTIPLE_CLICK
+        if (BTN_CFG(Key)->MultipleClickMode == BTN_MULTIPLE_CLICK_COMBINED_MODE && Key->ClickCounter != 0)
+        {
+            Left = ButtonTimeLeft(Key->LastClickTick, (BTN_TIME_t)(BTN_CFG(Key)->TimerBetweenClick + 1U), Now);
+        }
+#endif
+#if BTN_NON_USED_CALLBACK
+        if (BTN_CFG(Key)->TimerNonUsed)
+        {
+            BTN_TIME_t NonUsed = ButtonTimeLeft(Key->LastTick, BTN_CFG(Key)->TimerNonUsed, Now);
+
+            if (NonUsed < Left)
+            {
+                Left = NonUsed;
+            }
+        }
+#endif
+#if BTN_LEADING_EDGE
+        Lockout = ButtonLockoutLeft(Key, Now);
+        if (Lockout != 0U && Lockout < Left)
+        {
+            Left = Lockout;
+        }
+#endif
+        break;
+
+    case DEBOUNCE:
+        Left = ButtonTimeLeft(Key->LastTick, ButtonDebounceTime(Key), Now);
+        break;
+
+    case PRESSED:
+        Left = ButtonTimeLeft(Key->LastTick, BTN_CFG(Key)->TimerLongPressed, Now);
+#if BTN_LEADING_EDGE
+        Lockout = ButtonLockoutLeft(Key, Now);
+        if (Lockout != 0U && Lockout < Left)
+        {
+            Left = Lockout;
+        }
+#endif
+        break;
+
+    case REPEAT:
+#if BTN_MULTIPLE_CLICK
+        if (ButtonEventEnabled(Key, BTN_EVENT_PRESSED) && !Key->CombinedModeRepeatPressEx)
+        {
+            Left = 0;
+            break;
+        }
+#endif
+        Left = ButtonTimeLeft(Key->LastTick, ButtonRepeatPeriod(Key), Now);
+        break;
+
+#if BTN_DOUBLE_DEBOUNCING
+    case DEBOUNCE_RELEASE:
+        Left = ButtonTimeLeft(Key->LastTickSecondDebounce, ButtonReleaseDebounceTime(Key), Now);
+        break;
+#endif
+
+    default:
+        Left = 0;
+        break;
+    }
+    return Left;
+}
+
+#if BTN_EDGE_WAKEUP
+/* ================================ Edge wake-up
+ * ================================ */
+/**
+ * @brief Checks whether a button in edge wake-up mode can be skipped.
+ *
+ * A sleeping button is skipped until `ButtonNotifyEdge()` reports an edge on
+ * its pin. The edge moves it into `DEBOUNCE` (or lets it sample its debounced
+ * input right away when `Debounced` is set). An edge reported while the button
+ * is awake needs no wake-up, since the button is polled anyway.
+ *
+ * The input of the pass has already been sampled when the edge is consumed, so
+ * it may predate the edge. `Edge` tells the caller that an edge was consumed:
+ * the button must then not fall asleep in this pass, otherwise a press whose
+ * edge landed between the sample and this call would be lost.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Debounced Non-zero if the button consumes an already debounced input.
+ * @param Now Tick of the current pass.
+ * @param Edge Output: 1 if a pending edge was consumed in this call, 0
+ * otherwise.
+ * @return 1 if the button is asleep and must not be processed, 0 otherwise.
+ */
+static uint8_t ButtonEdgeSleeping(button_t *Key, uint8_t Debounced, BTN_TIME_t Now, uint8_t *Edge)
+{
+    *Edge = 0;
+    if (!Key->EdgeWakeup)
+    {
+        return 0;
+    }
+    if (!Key->EdgePending)
+    {
+        return Key->Asleep;
+    }
+
+    Key->EdgePending = 0;
+    *Edge = 1;
+    if (Key->Asleep)
+    {
+        Key->Asleep = 0;
+        if (!Debounced)
+        {
+            ButtonDebounceBegin(Key, Now);
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Puts a button in edge wake-up mode to sleep when it has nothing left
+ * to do.
+ *
+ * The button falls asleep once a full `IDLE` pass has run without consuming an
+ * edge, and no multiple click or non-used timer is pending.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param MaySleep Non-zero if the button was in `IDLE` before this pass and no
+ * edge was consumed in it.
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonEdgeUpdate(button_t *Key, uint8_t MaySleep, BTN_TIME_t Now)
+{
+    if (Key->EdgeWakeup && MaySleep && Key->State == IDLE &&
+        ButtonTimeToDeadline(Key, Now) == BTN_MAX_TIMEOUT)
+    {
+        Key->Asleep = 1;
+#if BTN_STATS
+        Key->StatsRunning = 0;
+#endif
+    }
+}
+
+/**
+ * @brief Checks whether a task may skip a button without even reading its pin.
+ *
+ * A sleeping button without a pending edge is skipped, unless a configuration
+ * has been published for it: the button is then run so that it adopts the
+ * configuration, and stays asleep.
+ *
+ * @param Key Pointer to the button structure.
+ * @return 1 if the button can be skipped, 0 otherwise.
+ */
+static uint8_t ButtonEdgeSkip(const button_t *Key)
+{
+#if BTN_ATOMIC_CONFIG
+    if (Key->ConfigNext != Key->Config)
+    {
+        return 0;
+    }
+#endif
+    return (uint8_t)(Key->Asleep && !Key->EdgePending);
+}
+#endif
+
+#if BTN_TABLE_CORE || BTN_GROUP_ACTIVE_LIST
+/**
+ * @brief Returns the position of the only set bit of a word.
+ *
+ * @param Bit Word with exactly one bit set.
+ * @return Index of the set bit (0 for the least significant one).
+ */
+static uint8_t ButtonBitIndex(uint32_t Bit)
+{
+    static const uint8_t DeBruijn[32] = {0,  1,  28, 2,  29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4,  8,
+                                         31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6,  11, 5,  10, 9};
+
+    return DeBruijn[(uint32_t)(Bit * 0x077CB531U) >> 27];
+}
+#endif
+
+/* =================================== State machine
+ * ================================== */
+#if BTN_TABLE_CORE
+/*
+ * Table-driven core.
+ *
+ * A pass classifies the button by its state, its input level and whether the
+ * timer of that state has expired, and reads one cell of `BTN_Transitions`.
+ * The cell holds the next state in its top 8 bits and the actions of the
+ * transition as a bit mask in its low 24 bits; the actions run in bit order,
+ * at most four of them per cell. Actions of disabled features are 0, so every
+ * configuration compiles its own table. The release states are left in the
+ * cell that accepts the release, so `RELEASE` and `RELEASE_AFTER_REPEAT` are
+ * never entered and a release is delivered on the tick it is accepted.
+ */
+enum
+{
+    BTN_ACTION_CLICK_IDLE,         /**< `multipleClikIdle()`. */
+    BTN_ACTION_CLICK_REPEAT,       /**< `multipleClikRepeat()`. */
+    BTN_ACTION_ADAPT_TRACK,        /**< Record an input change during a debounce. */
+    BTN_ACTION_DEBOUNCE_BEGIN,     /**< Start debouncing a press. */
+    BTN_ACTION_LEARN_PRESS,        /**< Learn the press settling time. */
+    BTN_ACTION_PRESS_ACCEPT,       /**< Accept the press. */
+    BTN_ACTION_DEBOUNCE_ABORT,     /**< Count an aborted press debounce. */
+    BTN_ACTION_LONG_PRESS,         /**< Accept the long press. */
+    BTN_ACTION_REPEAT,             /**< Deliver the next repeat. */
+    BTN_ACTION_RELEASE_BEGIN,      /**< Start debouncing a release. */
+    BTN_ACTION_GLITCH,             /**< Learn from a release glitch while held. */
+    BTN_ACTION_LEARN_RELEASE,      /**< Learn the release settling time. */
+    BTN_ACTION_RELEASE_RECORD,     /**< Book-keeping of an accepted release. */
+    BTN_ACTION_EMIT_RELEASE,       /**< Deliver the release. */
+    BTN_ACTION_EMIT_AFTER_REPEAT,  /**< Deliver the release after repeat. */
+    BTN_ACTION_EMIT_HELD_RELEASE,  /**< Deliver the release of the state before `DEBOUNCE_RELEASE`. */
+    BTN_ACTION_NON_USED            /**< Deliver the non-used event. */
+};
+
+/* Next state of a cell that returns to `StateBeforeRelease`. */
+#define BTN_NEXT_HELD 0xFFU
+
+/* Builds a cell of `BTN_Transitions`. */
+#define BTN_CELL(Next, Actions) (((uint32_t)(Next) << 24) | (uint32_t)(Actions))
+#define BTN_DO(Action) ((uint32_t)1U << (Action))
+
+#if BTN_MULTIPLE_CLICK
+#define BTN_DO_CLICK_IDLE BTN_DO(BTN_ACTION_CLICK_IDLE)
+#define BTN_DO_CLICK_REPEAT BTN_DO(BTN_ACTION_CLICK_REPEAT)
+#else
+#define BTN_DO_CLICK_IDLE 0U
+#define BTN_DO_CLICK_REPEAT 0U
+#endif
+#if BTN_ADAPTIVE_DEBOUNCE
+#define BTN_DO_ADAPT_TRACK BTN_DO(BTN_ACTION_ADAPT_TRACK)
+#define BTN_DO_LEARN_PRESS BTN_DO(BTN_ACTION_LEARN_PRESS)
+#define BTN_DO_GLITCH BTN_DO(BTN_ACTION_GLITCH)
+#define BTN_DO_LEARN_RELEASE BTN_DO(BTN_ACTION_LEARN_RELEASE)
+#else
+#define BTN_DO_ADAPT_TRACK 0U
+#define BTN_DO_LEARN_PRESS 0U
+#define BTN_DO_GLITCH 0U
+#define BTN_DO_LEARN_RELEASE 0U
+#endif
+#if BTN_STATS
+#define BTN_DO_DEBOUNCE_ABORT BTN_DO(BTN_ACTION_DEBOUNCE_ABORT)
+#else
+#define BTN_DO_DEBOUNCE_ABORT 0U
+#endif
+#if BTN_STATS || BTN_LEADING_EDGE || BTN_EVENT_PRESS_INFO
+#define BTN_DO_RELEASE_RECORD BTN_DO(BTN_ACTION_RELEASE_RECORD)
+#else
+#define BTN_DO_RELEASE_RECORD 0U
+#endif
+#if BTN_RELEASE_AFTER_REPEAT
+#define BTN_DO_EMIT_AFTER_REPEAT BTN_DO(BTN_ACTION_EMIT_AFTER_REPEAT)
+#define BTN_DO_EMIT_HELD_RELEASE BTN_DO(BTN_ACTION_EMIT_HELD_RELEASE)
+#else
+#define BTN_DO_EMIT_AFTER_REPEAT BTN_DO(BTN_ACTION_EMIT_RELEASE)
+#define BTN_DO_EMIT_HELD_RELEASE BTN_DO(BTN_ACTION_EMIT_RELEASE)
+#endif
+#if BTN_NON_USED_CALLBACK
+#define BTN_DO_NON_USED BTN_DO(BTN_ACTION_NON_USED)
+#else
+#define BTN_DO_NON_USED 0U
+#endif
+
+/* Cells of an accepted release, and of a release that still needs debouncing. */
+#define BTN_RELEASE_PRESSED BTN_CELL(IDLE, BTN_DO_RELEASE_RECORD | BTN_DO(BTN_ACTION_EMIT_RELEASE))
+#define BTN_RELEASE_REPEAT BTN_CELL(IDLE, BTN_DO_CLICK_REPEAT | BTN_DO_RELEASE_RECORD | BTN_DO_EMIT_AFTER_REPEAT)
+#if BTN_DOUBLE_DEBOUNCING
+#define BTN_DEBOUNCE_PRESSED BTN_CELL(DEBOUNCE_RELEASE, BTN_DO(BTN_ACTION_RELEASE_BEGIN))
+#define BTN_DEBOUNCE_REPEAT BTN_CELL(DEBOUNCE_RELEASE, BTN_DO_CLICK_REPEAT | BTN_DO(BTN_ACTION_RELEASE_BEGIN))
+#else
+#define BTN_DEBOUNCE_PRESSED BTN_RELEASE_PRESSED
+#define BTN_DEBOUNCE_REPEAT BTN_RELEASE_REPEAT
+#endif
+
+/* Row of a state: cells for (released, timer running), (released, expired), (pressed, running), (pressed, expired). */
+#define BTN_ROW(Released, ReleasedDue, Pressed, PressedDue) {{(Released), (ReleasedDue)}, {(Pressed), (PressedDue)}}
+
+#define BTN_ROW_IDLE_DEBOUNCE                                                                                         \
+    BTN_ROW(BTN_CELL(IDLE, BTN_DO_CLICK_IDLE), BTN_CELL(IDLE, BTN_DO_CLICK_IDLE | BTN_DO_NON_USED),                   \
+            BTN_CELL(DEBOUNCE, BTN_DO_CLICK_IDLE | BTN_DO(BTN_ACTION_DEBOUNCE_BEGIN)),                                \
+            BTN_CELL(DEBOUNCE, BTN_DO_CLICK_IDLE | BTN_DO(BTN_ACTION_DEBOUNCE_BEGIN)))
+#define BTN_ROW_IDLE_ACCEPT                                                                                           \
+    BTN_ROW(BTN_CELL(IDLE, BTN_DO_CLICK_IDLE), BTN_CELL(IDLE, BTN_DO_CLICK_IDLE | BTN_DO_NON_USED),                   \
+            BTN_CELL(PRESSED,                                                                                         \
+                     BTN_DO_CLICK_IDLE | BTN_DO(BTN_ACTION_DEBOUNCE_BEGIN) | BTN_DO(BTN_ACTION_PRESS_ACCEPT)),        \
+            BTN_CELL(PRESSED,                                                                                         \
+                     BTN_DO_CLICK_IDLE | BTN_DO(BTN_ACTION_DEBOUNCE_BEGIN) | BTN_DO(BTN_ACTION_PRESS_ACCEPT)))
+#define BTN_ROW_DEBOUNCE_SETTLE                                                                                       \
+    BTN_ROW(BTN_CELL(DEBOUNCE, BTN_DO_ADAPT_TRACK), BTN_CELL(IDLE, BTN_DO_ADAPT_TRACK | BTN_DO_DEBOUNCE_ABORT),       \
+            BTN_CELL(DEBOUNCE, BTN_DO_ADAPT_TRACK),                                                                   \
+            BTN_CELL(PRESSED, BTN_DO_ADAPT_TRACK | BTN_DO_LEARN_PRESS | BTN_DO(BTN_ACTION_PRESS_ACCEPT)))
+#define BTN_ROW_DEBOUNCE_LEADING                                                                                      \
+    BTN_ROW(BTN_CELL(DEBOUNCE, BTN_DO_ADAPT_TRACK), BTN_CELL(IDLE, BTN_DO_ADAPT_TRACK | BTN_DO_DEBOUNCE_ABORT),       \
+            BTN_CELL(PRESSED, BTN_DO(BTN_ACTION_PRESS_ACCEPT)), BTN_CELL(PRESSED, BTN_DO(BTN_ACTION_PRESS_ACCEPT)))
+#define BTN_ROW_PRESSED(Release)                                                                                      \
+    BTN_ROW((Release), (Release), BTN_CELL(PRESSED, 0U), BTN_CELL(REPEAT, BTN_DO(BTN_ACTION_LONG_PRESS)))
+#define BTN_ROW_REPEAT(Release)                                                                                       \
+    BTN_ROW((Release), (Release), BTN_CELL(REPEAT, BTN_DO_CLICK_REPEAT),                                              \
+            BTN_CELL(REPEAT, BTN_DO_CLICK_REPEAT | BTN_DO(BTN_ACTION_REPEAT)))
+#define BTN_ROW_DONE(Emit)                                                                                            \
+    BTN_ROW(BTN_CELL(IDLE, Emit), BTN_CELL(IDLE, Emit), BTN_CELL(IDLE, Emit), BTN_CELL(IDLE, Emit))
+
+#if BTN_DOUBLE_DEBOUNCING
+#define BTN_RELEASE_SETTLED                                                                                           \
+    (BTN_DO_ADAPT_TRACK | BTN_DO_LEARN_RELEASE | BTN_DO_RELEASE_RECORD | BTN_DO_EMIT_HELD_RELEASE)
+#define BTN_ROW_AT_DEBOUNCE_RELEASE                                                                                   \
+    , [DEBOUNCE_RELEASE] = BTN_ROW(BTN_CELL(DEBOUNCE_RELEASE, BTN_DO_ADAPT_TRACK),                                    \
+                                   BTN_CELL(IDLE, BTN_RELEASE_SETTLED),                                               \
+                                   BTN_CELL(DEBOUNCE_RELEASE, BTN_DO_ADAPT_TRACK),                                    \
+                                   BTN_CELL(BTN_NEXT_HELD, BTN_DO_ADAPT_TRACK | BTN_DO_GLITCH))
+#else
+#define BTN_ROW_AT_DEBOUNCE_RELEASE
+#endif
+#if BTN_RELEASE_AFTER_REPEAT
+#define BTN_ROW_AT_RELEASE_AFTER_REPEAT , [RELEASE_AFTER_REPEAT] = BTN_ROW_DONE(BTN_DO_EMIT_AFTER_REPEAT)
+#define BTN_TABLE_STATES (RELEASE_AFTER_REPEAT + 1)
+#else
+#define BTN_ROW_AT_RELEASE_AFTER_REPEAT
+#if BTN_DOUBLE_DEBOUNCING
+#define BTN_TABLE_STATES (DEBOUNCE_RELEASE + 1)
+#else
+#define BTN_TABLE_STATES (RELEASE + 1)
+#endif
+#endif
+
+#define BTN_TABLE_MODE(Idle, Debounce, PressedRelease, RepeatRelease)                                                 \
+    {                                                                                                                 \
+        [IDLE] = Idle, [DEBOUNCE] = Debounce, [PRESSED] = BTN_ROW_PRESSED(PressedRelease),                            \
+        [REPEAT] = BTN_ROW_REPEAT(RepeatRelease),                                                                     \
+        [RELEASE] = BTN_ROW_DONE(BTN_DO(BTN_ACTION_EMIT_RELEASE)) BTN_ROW_AT_DEBOUNCE_RELEASE                         \
+            BTN_ROW_AT_RELEASE_AFTER_REPEAT                                                                           \
+    }
+
+/*
+ * Transitions indexed by [mode][state][level][timer expired]. The mode is 1
+ * for an already debounced input, plus 2 for a leading edge button.
+ */
+static const uint32_t BTN_Transitions[][BTN_TABLE_STATES][2][2] = {
+    BTN_TABLE_MODE(BTN_ROW_IDLE_DEBOUNCE, BTN_ROW_DEBOUNCE_SETTLE, BTN_DEBOUNCE_PRESSED, BTN_DEBOUNCE_REPEAT),
+    BTN_TABLE_MODE(BTN_ROW_IDLE_ACCEPT, BTN_ROW_DEBOUNCE_SETTLE, BTN_RELEASE_PRESSED, BTN_RELEASE_REPEAT),
+#if BTN_LEADING_EDGE
+    BTN_TABLE_MODE(BTN_ROW_IDLE_ACCEPT, BTN_ROW_DEBOUNCE_LEADING, BTN_DEBOUNCE_PRESSED, BTN_DEBOUNCE_REPEAT),
+    BTN_TABLE_MODE(BTN_ROW_IDLE_ACCEPT, BTN_ROW_DEBOUNCE_LEADING, BTN_RELEASE_PRESSED, BTN_RELEASE_REPEAT),
+#endif
+};
+
+/**
+ * @brief Checks whether the timer the current state of a button waits for has
+ * expired.
+ *
+ * In sample count mode (`BTN_SAMPLE_DEBOUNCE`) the debounce states count the
+ * sample of this pass here.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Active Logical pressed state of the button in this pass.
+ * @param Now Tick of the current pass.
+ * @return 1 if the timer has expired, 0 otherwise or if the state has no timer.
+ */
+static uint8_t ButtonTableExpired(button_t *Key, uint8_t Active, BTN_TIME_t Now)
+{
+    switch (Key->State)
+    {
+#if BTN_NON_USED_CALLBACK
+    case IDLE:
+        return BTN_CFG(Key)->TimerNonUsed && (BTN_ELAPSED(Now, Key->LastTick) >= BTN_CFG(Key)->TimerNonUsed);
+#endif
+
+    case DEBOUNCE:
+        return ButtonDebounceSettled(Key, Active, Key->LastTick, ButtonDebounceTime(Key), Now);
+
+    case PRESSED:
+        return BTN_ELAPSED(Now, Key->LastTick) >= BTN_CFG(Key)->TimerLongPressed;
+
+    case REPEAT:
+        return BTN_ELAPSED(Now, Key->LastTick) >= ButtonRepeatPeriod(Key);
+
+#if BTN_DOUBLE_DEBOUNCING
+    case DEBOUNCE_RELEASE:
+        return ButtonDebounceSettled(Key, Active, Key->LastTickSecondDebounce, ButtonReleaseDebounceTime(Key), Now);
+#endif
+
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Runs one action of a transition of the table-driven core.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Action The action (`BTN_ACTION_*`).
+ * @param Active Logical pressed state of the button in this pass.
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonTableAction(button_t *Key, uint8_t Action, uint8_t Active, BTN_TIME_t Now)
+{
+    (void)Active;
+
+    switch (Action)
+    {
+#if BTN_MULTIPLE_CLICK
+    case BTN_ACTION_CLICK_IDLE:
+        multipleClikIdle(Key, Now);
+        break;
+
+    case BTN_ACTION_CLICK_REPEAT:
+        multipleClikRepeat(Key, Now);
+        break;
+#endif
+
+#if BTN_ADAPTIVE_DEBOUNCE
+    case BTN_ACTION_ADAPT_TRACK:
+        ButtonAdaptTrack(Key, Active, Now);
+        break;
+
+    case BTN_ACTION_LEARN_PRESS:
+        ButtonAdaptLearn(&Key->AdaptPress, BTN_ELAPSED(Key->AdaptEdge, Key->LastTick), ButtonDebounceTime(Key));
+        break;
+
+#if BTN_DOUBLE_DEBOUNCING
+    case BTN_ACTION_GLITCH:
+        ButtonAdaptGlitch(Key);
+        break;
+
+    case BTN_ACTION_LEARN_RELEASE:
+        ButtonAdaptLearn(&Key->AdaptRelease, BTN_ELAPSED(Key->AdaptEdge, Key->LastTickSecondDebounce),
+                         ButtonReleaseDebounceTime(Key));
+        break;
+#endif
+#endif
+
+    case BTN_ACTION_DEBOUNCE_BEGIN:
+        ButtonDebounceBegin(Key, Now);
+        break;
+
+    case BTN_ACTION_PRESS_ACCEPT:
+        ButtonPressAccept(Key, Now);
+        break;
+
+#if BTN_STATS
+    case BTN_ACTION_DEBOUNCE_ABORT:
+        ButtonStatsCount(&Key->Stats.DebounceAborts);
+        break;
+#endif
+
+    case BTN_ACTION_LONG_PRESS:
+        ButtonLongPressAccept(Key, Now);
+        break;
+
+    case BTN_ACTION_REPEAT:
+        ButtonRepeatFire(Key, Now);
+        break;
+
+#if BTN_DOUBLE_DEBOUNCING
+    case BTN_ACTION_RELEASE_BEGIN:
+        ButtonReleaseDebounceBegin(Key, Now);
+        break;
+#endif
+
+    case BTN_ACTION_RELEASE_RECORD:
+        ButtonReleaseRecord(Key, Now);
+        break;
+
+    case BTN_ACTION_EMIT_RELEASE:
+        ButtonEmit(Key, BTN_EVENT_RELEASE, Now);
+        break;
+
+#if BTN_RELEASE_AFTER_REPEAT
+    case BTN_ACTION_EMIT_AFTER_REPEAT:
+        ButtonEmit(Key, BTN_EVENT_RELEASE_AFTER_REPEAT, Now);
+        break;
+
+#if BTN_DOUBLE_DEBOUNCING
+    case BTN_ACTION_EMIT_HELD_RELEASE:
+        ButtonEmit(Key, (Key->StateBeforeRelease == REPEAT) ? BTN_EVENT_RELEASE_AFTER_REPEAT : BTN_EVENT_RELEASE,
+                   Now);
+        break;
+#endif
+#endif
+
+#if BTN_NON_USED_CALLBACK
+    case BTN_ACTION_NON_USED:
+        Key->LastTick = Now;
+        ButtonEmit(Key, BTN_EVENT_NON_USED, Now);
+        break;
+#endif
+
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Runs one pass of the table-driven core.
+ *
+ * Classifies the button by its state, input level and timer, runs the actions
+ * of the matching cell of `BTN_Transitions` and enters its next state. The
+ * edge lockout of a leading edge button masks the input: a press while idle is
+ * ignored, and a release while pressed is held back.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Active Logical pressed state of the button in this pass.
+ * @param Debounced Non-zero if `Active` comes from an already debounced source.
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonTableStep(button_t *Key, uint8_t Active, uint8_t Debounced, BTN_TIME_t Now)
+{
+    uint8_t Level = (Active != 0U);
+    uint8_t Mode = (uint8_t)((Debounced != 0U) | ((ButtonLeadingEdge(Key) != 0U) << 1));
+    uint8_t Expired = ButtonTableExpired(Key, Level, Now);
+    uint32_t Cell;
+    uint32_t Actions;
+    uint8_t Next;
+
+#if BTN_LEADING_EDGE
+    if (Key->State == IDLE && ButtonLockedOut(Key, Now))
+    {
+        Level = 0;
+    }
+    else if (Key->State == PRESSED && !Level && ButtonLockedOut(Key, Now))
+    {
+        Level = 1;
+        Expired = 0;
+    }
+#endif
+
+    Cell = BTN_Transitions[Mode][Key->State][Level][Expired];
+    Actions = Cell & 0x00FFFFFFU;
+    while (Actions)
+    {
+        uint32_t Bit = Actions & (~Actions + 1U);
+
+        ButtonTableAction(Key, ButtonBitIndex(Bit), Level, Now);
+        Actions &= ~Bit;
+    }
+
+    Next = (uint8_t)(Cell >> 24);
+#if BTN_DOUBLE_DEBOUNCING
+    Key->State = (Next == BTN_NEXT_HELD) ? Key->StateBeforeRelease : (ButtonState_t)Next;
+#else
+    Key->State = (ButtonState_t)Next;
+#endif
+}
+#endif
+
+/**
+ * @brief Runs one step of the button state machine on a sampled input.
+ *
+ * Evaluates the current button state (`State`) and calls the corresponding
+ * state handling function:
+ *   - `ButtonIdleRoutine` for the `IDLE` state.
+ *   - `ButtonDebounceRoutine` for the `DEBOUNCE` state.
+ *   - `ButtonPressedRoutine` for the `PRESSED` state.
+ *   - `ButtonRepeatRoutine` for the `REPEAT` state.
+ *   - `ButtonDebounceReleaseRoutine` for the `DEBOUNCE_RELEASE` state.
+ *   - `ButtonReleaseRoutine` for the `RELEASE` state.
+ *   - `ButtonReleaseAfterRepeatRoutine` for the `RELEASE_AFTER_REPEAT` state,
+ * if enabled.
+ *
+ * The input is sampled by the caller, so the same routines serve both the
+ * single-button `ButtonTask()` and the batched `ButtonGroupTask()`. When the
+ * input is already debounced (`BTN_GROUP_VERTICAL_DEBOUNCE`), the `DEBOUNCE`
+ * and `DEBOUNCE_RELEASE` states are skipped. Buttons sleeping in edge wake-up
+ * mode (`BTN_EDGE_WAKEUP`) are not processed at all. A configuration published
+ * with `BTN_ATOMIC_CONFIG` is adopted before anything else.
+ *
+ * With `BTN_TABLE_CORE` the pass is one lookup in the transition table
+ * `BTN_Transitions` instead (see `ButtonTableStep`).
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Active Logical pressed state of the button in this pass.
+ * @param Debounced Non-zero if `Active` comes from an already debounced source.
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonProcess(button_t *Key, uint8_t Active, uint8_t Debounced, BTN_TIME_t Now)
+{
+#if BTN_EDGE_WAKEUP
+    uint8_t Edge;
+    uint8_t MaySleep;
+#endif
+
+#if BTN_ATOMIC_CONFIG
+    ButtonConfigAdopt(Key);
+#endif
+#if BTN_EDGE_WAKEUP
+    if (ButtonEdgeSleeping(Key, Debounced, Now, &Edge))
+    {
+        return;
+    }
+    MaySleep = (Key->State == IDLE) && !Edge;
+#endif
+#if BTN_STATS
+    ButtonStatsPass(Key, Active, Now);
+#endif
+
+#if BTN_TABLE_CORE
+    ButtonTableStep(Key, Active, Debounced, Now);
+#else
+    switch (Key->State)
+    {
+    case IDLE:
+        ButtonIdleRoutine(Key, Active, Debounced, Now);
+        break;
+
+    case DEBOUNCE:
+        ButtonDebounceRoutine(Key, Active, Debounced, Now);
+        break;
+
+    case PRESSED:
+        ButtonPressedRoutine(Key, Active, Debounced, Now);
+        break;
+
+    case REPEAT:
+        ButtonRepeatRoutine(Key, Active, Debounced, Now);
+        break;
+
+#if BTN_DOUBLE_DEBOUNCING
+    case DEBOUNCE_RELEASE:
+        ButtonDebounceReleaseRoutine(Key, Active, Debounced, Now);
+        break;
+#endif
+
+    case RELEASE:
+        ButtonReleaseRoutine(Key, Active, Debounced, Now);
+        break;
+
+#if BTN_RELEASE_AFTER_REPEAT
+    case RELEASE_AFTER_REPEAT:
+        ButtonReleaseAfterRepeatRoutine(Key, Active, Debounced, Now);
+        break;
+#endif
+    }
+#endif
+
+#if BTN_EDGE_WAKEUP
+    ButtonEdgeUpdate(Key, MaySleep, Now);
+#endif
+}
+
+/**
+ * @brief Handles the button state machine and triggers appropriate routines
+ * based on the button's current state.
+ *
+ * This function is responsible for managing the button state transitions and
+ * calling the corresponding routine for each state (e.g., IDLE, DEBOUNCE,
+ * PRESSED, REPEAT, RELEASE, RELEASE_AFTER_REPEAT). It should be invoked in the
+ * main loop or the main system task to continuously check and process the
+ * button's state.
+ *
+ * Actions performed:
+ * - Samples the tick once; all timing decisions of the pass use this value.
+ * - Reads the button's GPIO pin once and converts it into the logical pressed
+ * state based on the reverse logic configuration.
+ * - Runs one step of the state machine (`ButtonProcess`) on that sample.
+ *
+ * @param Key Pointer to the button structure being processed.
+ *
+ * @note This function should be called in the main loop or system task to
+ * ensure the button state machine is regularly processed. The specific state
+ * handling functions are invoked based on the current state of the button.
+ *
+ * @return Status of the button operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+
+BTN_operate_status ButtonTask(button_t *Key)
+{
+    return ButtonTaskAt(Key, BTN_GET_TICK);
+}
+
+/**
+ * @brief Runs the button state machine at an explicitly given tick.
+ *
+ * Same as `ButtonTask()`, but the registered tick source is not sampled; all
+ * timing decisions of this pass use `Now`. This lets the caller sample the tick
+ * once and process many buttons against the same time.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Now Current tick.
+ * @return Status of the button operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonTaskAt(button_t *Key, BTN_TIME_t Now)
+{
+    if (Key == NULL || !BTN_CFG_VALID(Key) || Key->GpioPort == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+#if BTN_EDGE_WAKEUP
+    if (ButtonEdgeSkip(Key))
+    {
+        return BTN_OK;
+    }
+#endif
+    ButtonProcess(Key, ButtonIsActive(Key, ReadState(Key->GpioPort, Key->GpioPin)), 0, Now);
+    return BTN_OK;
+}
+
+/**
+ * @brief Runs the button state machine on an input sampled by the caller.
+ *
+ * Entry point for input sources that do not map to one GPIO pin per button
+ * (e.g. a keypad matrix): the caller determines the logical pressed state and
+ * the button is processed exactly as by `ButtonTaskAt()`, including debouncing.
+ * The reverse logic setting of the button is not applied to `Active`.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Active Logical pressed state of the button (non-zero when pressed).
+ * @param Now Current tick.
+ * @return Status of the button operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonFeedInput(button_t *Key, uint8_t Active, BTN_TIME_t Now)
+{
+    if (Key == NULL || !BTN_CFG_VALID(Key))
+    {
+        return BTN_ERROR;
+    }
+
+    ButtonProcess(Key, Active != 0U, 0, Now);
+    return BTN_OK;
+}
+
+#if BTN_PIN_TABLE
+/**
+ * @brief Runs the state machines of buttons described by a pin table.
+ *
+ * @param Keys Array of `Count` buttons.
+ * @param Pins Array of `Count` pin descriptions.
+ * @param Count Number of buttons.
+ * @return Status of the task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonPinTableTask(button_t *Keys, const button_pin_t *Pins, uint16_t Count)
+{
+    return ButtonPinTableTaskAt(Keys, Pins, Count, BTN_GET_TICK);
+}
+
+/**
+ * @brief Runs the state machines of buttons described by a pin table at an
+ * explicitly given tick.
+ *
+ * Every button is read with one input register load, XOR-ed with the active
+ * level mask of its entry and masked with its pin; there is no call into the
+ * HAL and no branch on the reverse logic.
+ *
+ * @param Keys Array of `Count` buttons.
+ * @param Pins Array of `Count` pin descriptions.
+ * @param Count Number of buttons.
+ * @param Now Current tick.
+ * @return Status of the task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonPinTableTaskAt(button_t *Keys, const button_pin_t *Pins, uint16_t Count, BTN_TIME_t Now)
+{
+    if (Keys == NULL || Pins == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    for (uint16_t i = 0; i < Count; i++)
+    {
+        button_t *Key = &Keys[i];
+        const button_pin_t *Pin = &Pins[i];
+
+        if (!BTN_CFG_VALID(Key))
+        {
+            return BTN_ERROR;
+        }
+#if BTN_EDGE_WAKEUP
+        if (ButtonEdgeSkip(Key))
+        {
+            continue;
+        }
+#endif
+        ButtonProcess(Key, BTN_PIN_IS_ACTIVE(Pin->Port, Pin->Pin, Pin->Xor), 0, Now);
+    }
+    return BTN_OK;
+}
+#endif
+
+#if BTN_STATIC_TABLE
+/**
+ * @brief Binds a zero-initialized button to its static definition.
+ *
+ * Sets the fields of `ButtonInitRuntime()` that are not zero; the rest of the
+ * button is already cleared, so no `memset` is needed.
+ *
+ * @param Key Pointer to the zero-initialized button.
+ * @param Entry Definition of the button.
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonStaticBind(button_t *Key, const button_static_t *Entry, BTN_TIME_t Now)
+{
+    Key->GpioPort = Entry->Pin.Port;
+    Key->GpioPin = Entry->Pin.Pin;
+    Key->NumberBtn = Entry->Number;
+    Key->LastTick = Now;
+#if BTN_ADAPTIVE_DEBOUNCE
+    ButtonAdaptReset(Key);
+#endif
+#if BTN_STATS
+    Key->Stats.PressMin = BTN_MAX_TIMEOUT;
+#endif
+    Key->Config = Entry->Config;
+#if BTN_ATOMIC_CONFIG
+    Key->ConfigNext = Entry->Config;
+#endif
+}
+
+/**
+ * @brief Runs the state machines of statically defined buttons.
+ *
+ * @param Keys Array of `Count` buttons.
+ * @param Table Array of `Count` button definitions.
+ * @param Count Number of buttons.
+ * @return Status of the task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonStaticTask(button_t *Keys, const button_static_t *Table, uint16_t Count)
+{
+    return ButtonStaticTaskAt(Keys, Table, Count, BTN_GET_TICK);
+}
+
+/**
+ * @brief Runs the state machines of statically defined buttons at an
+ * explicitly given tick.
+ *
+ * A button without a configuration has not been run yet and is bound to its
+ * entry first. It is then read like a pin table button: one input register
+ * load, an XOR with the folded active level and an AND with its pin.
+ *
+ * @param Keys Array of `Count` buttons.
+ * @param Table Array of `Count` button definitions.
+ * @param Count Number of buttons.
+ * @param Now Current tick.
+ * @return Status of the task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonStaticTaskAt(button_t *Keys, const button_static_t *Table, uint16_t Count, BTN_TIME_t Now)
+{
+    if (Keys == NULL || Table == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    for (uint16_t i = 0; i < Count; i++)
+    {
+        button_t *Key = &Keys[i];
+        const button_static_t *Entry = &Table[i];
+
+        if (Key->Config == NULL)
+        {
+            if (Entry->Config == NULL)
+            {
+                return BTN_ERROR;
+            }
+            ButtonStaticBind(Key, Entry, Now);
+        }
+#if BTN_EDGE_WAKEUP
+        if (ButtonEdgeSkip(Key))
+        {
+            continue;
+        }
+#endif
+        ButtonProcess(Key, BTN_PIN_IS_ACTIVE(Entry->Pin.Port, Entry->Pin.Pin, Entry->Pin.Xor), 0, Now);
+    }
+    return BTN_OK;
+}
+#endif
+
+#if BTN_EDGE_WAKEUP
+/**
+ * @brief Enables or disables edge wake-up mode for a button.
+ *
+ * In this mode an idle button without pending timers stops being polled:
+ * `ButtonTask()` / `ButtonGroupTask()` skip it until `ButtonNotifyEdge()` (or
+ * `ButtonGroupNotifyEdge()`) is called for its pin, typically from the EXTI
+ * interrupt handler.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Enable 1 to enable edge wake-up mode, 0 to poll the button always.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonSetEdgeWakeup(button_t *Key, uint8_t Enable)
+{
+    if (Key == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    Key->Asleep = 0;
+    Key->EdgePending = 0;
+    Key->EdgeWakeup = Enable;
+    return BTN_OK;
+}
+
+/**
+ * @brief Reports an input edge on the button's pin.
+ *
+ * Safe to call from an interrupt handler: it only sets a flag, which the next
+ * `ButtonTask()` consumes to move a sleeping button into `DEBOUNCE`.
+ *
+ * @param Key Pointer to the button structure.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonNotifyEdge(button_t *Key)
+{
+    if (Key == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    Key->EdgePending = 1;
+    return BTN_OK;
+}
+#endif
+
+/* ================================ Next deadline
+ * ================================ */
+/**
+ * @brief Reports the time until the button's next timer-driven state change.
+ *
+ * Intended for tickless low-power operation: after `ButtonTask()`, the
+ * scheduler can sleep for the returned number of ticks (e.g. by programming an
+ * LPTIM wakeup). A state change caused by the button itself (a new press or a
+ * release) is not covered and has to wake the system through a GPIO edge.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Ticks Output: ticks until the next deadline (0 means `ButtonTask()`
+ * should be called again right away), or `BTN_MAX_TIMEOUT` if the button has
+ * no pending timer.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGetNextDeadline(const button_t *Key, BTN_TIME_t *Ticks)
+{
+    if (Key == NULL || !BTN_CFG_VALID(Key) || Ticks == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    *Ticks = ButtonTimeToDeadline(Key, BTN_GET_TICK);
+    return BTN_OK;
+}
+
+#if BTN_STATS
+/**
+ * @brief Copies the runtime statistics of a button.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Stats Output: copy of the button's statistics.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGetStats(const button_t *Key, button_stats_t *Stats)
+{
+    if (Key == NULL || Stats == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    *Stats = Key->Stats;
+    return BTN_OK;
+}
+
+/**
+ * @brief Clears the runtime statistics of a button.
+ *
+ * @param Key Pointer to the button structure.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonResetStats(button_t *Key)
+{
+    if (Key == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    ButtonStatsClear(Key);
+    return BTN_OK;
+}
+#endif
+
+#if BTN_GROUP
+/* ================================ Button group
+ * ================================ */
+#if BTN_GROUP_VERTICAL_DEBOUNCE
+/**
+ * @brief Feeds the current port snapshot into the group's vertical counters.
+ *
+ * Every pin has a 2-bit counter stored in the `CounterHigh`/`CounterLow`
+ * bit-planes. A pin whose pressed level differs from the debounced one counts
+ * down on each sample; the counter is reset as soon as the levels agree again.
+ * When it rolls over after 4 consecutive differing samples, the debounced
+ * state of the pin is toggled. All pins of a port are handled at once.
+ *
+ * Outputs per port:
+ * - `Pressed` - debounced pressed mask (polarity already applied).
+ * - `Changed` - pins whose debounced state toggled in this sample.
+ *
+ * @param Group Pointer to the group being processed.
+ *
+ * @return None
+ */
+static void ButtonGroupVerticalSample(button_group_t *Group)
+{
+    for (uint8_t Port = 0; Port < Group->PortsCount; Port++)
+    {
+        BTN_GPIO_PIN_T Delta =
+            (BTN_GPIO_PIN_T)((Group->PortState[Port] ^ Group->ActiveLow[Port]) ^ Group->Pressed[Port]);
+
+        Group->CounterLow[Port] = (BTN_GPIO_PIN_T)~(Group->CounterLow[Port] & Delta);
+        Group->CounterHigh[Port] = (BTN_GPIO_PIN_T)(Group->CounterLow[Port] ^ (Group->CounterHigh[Port] & Delta));
+        Delta &= Group->CounterLow[Port] & Group->CounterHigh[Port];
+        Group->Pressed[Port] ^= Delta;
+        Group->Changed[Port] = Delta;
+    }
+}
+#endif
+
+#if BTN_GROUP_ACTIVE_LIST
+#if BTN_GROUP_TIMER_HEAP
+/**
+ * @brief Returns the deadline of a heap entry relative to the current base.
+ *
+ * @param Group Pointer to the group.
+ * @param Slot Position in the heap.
+ * @return Ticks from `TimerBase` to the entry's `TimerDue`.
+ */
+static BTN_TIME_t ButtonTimerRank(const button_group_t *Group, uint16_t Slot)
+{
+    return BTN_ELAPSED(Group->Keys[Group->Timers[Slot]].TimerDue, Group->TimerBase);
+}
+
+/**
+ * @brief Stores a button at a position of the heap.
+ *
+ * @param Group Pointer to the group.
+ * @param Slot Position in the heap.
+ * @param Index Index of the button in `Group->Keys`.
+ *
+ * @return None
+ */
+static void ButtonTimerPlace(button_group_t *Group, uint16_t Slot, uint16_t Index)
+{
+    Group->Timers[Slot] = Index;
+    Group->Keys[Index].TimerSlot = (uint16_t)(Slot + 1U);
+}
+
+/**
+ * @brief Moves a heap entry up or down to its ordered position.
+ *
+ * @param Group Pointer to the group.
+ * @param Slot Current position of the entry.
+ *
+ * @return None
+ */
+static void ButtonTimerSift(button_group_t *Group, uint16_t Slot)
+{
+    uint16_t Index = Group->Timers[Slot];
+    BTN_TIME_t Rank = ButtonTimerRank(Group, Slot);
+
+    while (Slot > 0U)
+    {
+        uint16_t Parent = (uint16_t)((Slot - 1U) >> 1);
+
+        if (ButtonTimerRank(Group, Parent) <= Rank)
+        {
+            break;
+        }
+        ButtonTimerPlace(Group, Slot, Group->Timers[Parent]);
+        Slot = Parent;
+    }
+    for (;;)
+    {
+        uint16_t Child = (uint16_t)(2U * Slot + 1U);
+
+        if (Child >= Group->TimersCount)
+        {
+            break;
+        }
+        if (Child + 1U < Group->TimersCount &&
+            ButtonTimerRank(Group, (uint16_t)(Child + 1U)) < ButtonTimerRank(Group, Child))
+        {
+            Child++;
+        }
+        if (ButtonTimerRank(Group, Child) >= Rank)
+        {
+            break;
+        }
+        ButtonTimerPlace(Group, Slot, Group->Timers[Child]);
+        Slot = Child;
+    }
+    ButtonTimerPlace(Group, Slot, Index);
+}
+
+/**
+ * @brief Parks a button in the timer heap of its group.
+ *
+ * @param Group Pointer to the group.
+ * @param Index Index of the button in `Group->Keys`.
+ * @param Due Tick at which the button has to be run again.
+ *
+ * @return None
+ */
+static void ButtonTimerPark(button_group_t *Group, uint16_t Index, BTN_TIME_t Due)
+{
+    Group->Keys[Index].TimerDue = Due;
+    ButtonTimerPlace(Group, Group->TimersCount, Index);
+    Group->TimersCount++;
+    ButtonTimerSift(Group, (uint16_t)(Group->TimersCount - 1U));
+}
+
+/**
+ * @brief Removes a parked button from the timer heap of its group.
+ *
+ * @param Group Pointer to the group.
+ * @param Index Index of the button in `Group->Keys`.
+ *
+ * @return None
+ */
+static void ButtonTimerUnpark(button_group_t *Group, uint16_t Index)
+{
+    uint16_t Slot = (uint16_t)(Group->Keys[Index].TimerSlot - 1U);
+
+    Group->Keys[Index].TimerSlot = 0;
+    Group->TimersCount--;
+    if (Slot != Group->TimersCount)
+    {
+        ButtonTimerPlace(Group, Slot, Group->Timers[Group->TimersCount]);
+        ButtonTimerSift(Group, Slot);
+    }
+}
+
+/**
+ * @brief Marks busy the parked buttons whose deadline has been reached.
+ *
+ * Entries are popped from the top of the heap until the first one that is
+ * still in the future. The base of the remaining deadlines then moves to
+ * `Now`, which keeps their order: all of them are after `Now`.
+ *
+ * @param Group Pointer to the group being processed.
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonGroupWakeDue(button_group_t *Group, BTN_TIME_t Now)
+{
+    BTN_TIME_t Elapsed = BTN_ELAPSED(Now, Group->TimerBase);
+
+    while (Group->TimersCount != 0U && ButtonTimerRank(Group, 0) <= Elapsed)
+    {
+        uint16_t Index = Group->Timers[0];
+
+        ButtonTimerUnpark(Group, Index);
+        Group->Busy[Index >> 5] |= (uint32_t)1U << (Index & 31U);
+    }
+    Group->TimerBase = Now;
+}
+#endif
+
+/**
+ * @brief Marks every button of a group busy (and empties its timer heap).
+ *
+ * @param Group Pointer to the group.
+ *
+ * @return None
+ */
+static void ButtonGroupWakeAll(button_group_t *Group)
+{
+#if BTN_GROUP_TIMER_HEAP
+    while (Group->TimersCount != 0U)
+    {
+        ButtonTimerUnpark(Group, Group->Timers[Group->TimersCount - 1U]);
+    }
+#endif
+    memset(Group->Busy, 0, sizeof(Group->Busy));
+    for (uint16_t i = 0; i < Group->KeysCount; i++)
+    {
+        Group->Busy[i >> 5] |= (uint32_t)1U << (i & 31U);
+    }
+}
+
+/**
+ * @brief Marks busy the buttons whose input changed since the previous pass.
+ *
+ * The new input of every port is XOR-ed against the stored one; each changed
+ * pin wakes the button watching it, taking it out of the timer heap if it was
+ * parked there.
+ *
+ * @param Group Pointer to the group being processed.
+ * @param Input Input of the current pass per port.
+ *
+ * @return None
+ */
+static void ButtonGroupWakeChanged(button_group_t *Group, const BTN_GPIO_PIN_T *Input)
+{
+    for (uint8_t Port = 0; Port < Group->PortsCount; Port++)
+    {
+        BTN_GPIO_PIN_T Changed = (BTN_GPIO_PIN_T)(Input[Port] ^ Group->LastInput[Port]);
+
+        Group->LastInput[Port] = Input[Port];
+        while (Changed != 0U)
+        {
+            BTN_GPIO_PIN_T Bit = (BTN_GPIO_PIN_T)(Changed & (BTN_GPIO_PIN_T)(~Changed + 1U));
+            uint16_t Watcher = Group->PinKey[Port][ButtonBitIndex((uint32_t)Bit)];
+
+            Changed = (BTN_GPIO_PIN_T)(Changed ^ Bit);
+            if (Watcher != 0U)
+            {
+                Watcher--;
+#if BTN_GROUP_TIMER_HEAP
+                if (Group->Keys[Watcher].TimerSlot != 0U)
+                {
+                    ButtonTimerUnpark(Group, Watcher);
+                }
+#endif
+                Group->Busy[Watcher >> 5] |= (uint32_t)1U << (Watcher & 31U);
+            }
+        }
+    }
+}
+
+#endif
+
+/**
+ * @brief Returns the index of a GPIO port in a group's port list.
+ *
+ * A port not in the list yet is appended to it.
+ *
+ * @param Group Pointer to the group.
+ * @param GpioPort GPIO port to look up.
+ * @return Index of the port in `Ports`, or `BTN_GROUP_MAX_PORTS` if the list
+ * is full.
+ */
+static uint8_t ButtonGroupPortIndex(button_group_t *Group, BTN_GPIO_PORT_T *GpioPort)
+{
+    uint8_t Port;
+
+    for (Port = 0; Port < Group->PortsCount; Port++)
+    {
+        if (Group->Ports[Port] == GpioPort)
+        {
+            return Port;
+        }
+    }
+    if (Group->PortsCount < BTN_GROUP_MAX_PORTS)
+    {
+        Group->Ports[Group->PortsCount++] = GpioPort;
+    }
+    return Port;
+}
+
+/**
+ * @brief Initializes a button group over an array of buttons.
+ *
+ * This function walks the buttons, builds the list of distinct GPIO ports they
+ * use and stores each button's index into that list in `PortIndex`. The
+ * buttons have to be initialized (`ButtonInitKey` / `ButtonInitKeyDefault`)
+ * beforehand.
+ *
+ * @param Group Pointer to the group structure to initialize.
+ * @param Keys Array of already initialized buttons.
+ * @param KeysCount Number of buttons in `Keys`.
+ * @return Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if a pointer is NULL or the buttons use more than
+ *           `BTN_GROUP_MAX_PORTS` distinct ports.
+ */
+BTN_operate_status ButtonGroupInit(button_group_t *Group, button_t *Keys, uint16_t KeysCount)
+{
+    if (Group == NULL || Keys == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+#if BTN_GROUP_ACTIVE_LIST
+    if (KeysCount > BTN_GROUP_MAX_KEYS)
+    {
+        return BTN_ERROR;
+    }
+#endif
+
+    memset(Group, 0, sizeof(button_group_t));
+    Group->Keys = Keys;
+    Group->KeysCount = KeysCount;
+
+    for (uint16_t i = 0; i < KeysCount; i++)
+    {
+        uint8_t Port;
+
+        if (Keys[i].GpioPort == NULL || !BTN_CFG_VALID(&Keys[i]))
+        {
+            return BTN_ERROR;
+        }
+        Port = ButtonGroupPortIndex(Group, Keys[i].GpioPort);
+        if (Port >= BTN_GROUP_MAX_PORTS)
+        {
+            return BTN_ERROR;
+        }
+        Keys[i].PortIndex = Port;
+#if BTN_GROUP_VERTICAL_DEBOUNCE
+        if (BTN_CFG(&Keys[i])->ReverseLogic == NON_REVERSE)
+        {
+            Group->ActiveLow[Port] |= Keys[i].GpioPin;
+        }
+#endif
+#if BTN_GROUP_ACTIVE_LIST
+#if BTN_GROUP_TIMER_HEAP
+        Keys[i].TimerSlot = 0;
+#endif
+        Group->Pins[Port] |= Keys[i].GpioPin;
+        if (Keys[i].GpioPin != 0U && (Keys[i].GpioPin & (BTN_GPIO_PIN_T)(Keys[i].GpioPin - 1U)) == 0U)
+        {
+            uint16_t *Watcher = &Group->PinKey[Port][ButtonBitIndex((uint32_t)Keys[i].GpioPin)];
+
+            if (*Watcher == 0U)
+            {
+                *Watcher = (uint16_t)(i + 1U);
+            }
+        }
+#endif
+    }
+#if BTN_GROUP_ACTIVE_LIST
+    ButtonGroupWakeAll(Group);
+#endif
+    return BTN_OK;
+}
+
+#if BTN_GROUP_ACTIVE_LIST
+/**
+ * @brief Marks every button of a group busy for the next pass.
+ *
+ * An idle button is only run again when its input changes, so buttons whose
+ * configuration was changed at runtime have to be woken to pick up new timers.
+ *
+ * @param Group Pointer to the group.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGroupRefresh(button_group_t *Group)
+{
+    if (Group == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    ButtonGroupWakeAll(Group);
+    return BTN_OK;
+}
+#endif
+
+#if BTN_CHORD
+/**
+ * @brief Checks whether a button holds an accepted press.
+ *
+ * @param Key Pointer to the button structure.
+ * @return 1 from the accepted press until the release is accepted, 0
+ * otherwise.
+ */
+static uint8_t ButtonIsDown(const button_t *Key)
+{
+#if BTN_DOUBLE_DEBOUNCING
+    if (Key->State == DEBOUNCE_RELEASE)
+    {
+        return 1;
+    }
+#endif
+    return Key->State == PRESSED || Key->State == REPEAT;
+}
+
+/**
+ * @brief Runs one step of a chord on the debounced state of its group.
+ *
+ * The chord moves between its phases:
+ * - `IDLE` to `OPEN` when the first member is pressed; the window starts.
+ * - `OPEN` to `LATCHED` when all members are pressed within the window, or to
+ * `EXPIRED` when the window passes first.
+ * - `LATCHED` back to `OPEN` (no window) or to `EXPIRED` (with a window) when
+ * a member is released.
+ * - Any phase to `IDLE` once no member is pressed.
+ *
+ * For a suppressing chord, the members are added to the group's hold mask
+ * while the chord is undecided and to its mute mask while it is latched. The
+ * chord's virtual button is then run on the latched state.
+ *
+ * @param Group Pointer to the group owning the chord.
+ * @param Chord Pointer to the chord being processed.
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonChordProcess(button_group_t *Group, button_chord_t *Chord, BTN_TIME_t Now)
+{
+    uint8_t All = 1;
+    uint8_t Any = 0;
+
+    for (uint8_t Port = 0; Port < Group->PortsCount; Port++)
+    {
+        BTN_GPIO_PIN_T Down = (BTN_GPIO_PIN_T)(Group->ChordDown[Port] & Chord->Mask[Port]);
+
+        All &= (uint8_t)(Down == Chord->Mask[Port]);
+        Any |= (uint8_t)(Down != 0U);
+    }
+
+    if (!Any)
+    {
+        Chord->Phase = BTN_CHORD_IDLE;
+    }
+    else
+    {
+        if (Chord->Phase == BTN_CHORD_IDLE)
+        {
+            Chord->Phase = BTN_CHORD_OPEN;
+            Chord->FirstTick = Now;
+        }
+        if (Chord->Phase == BTN_CHORD_OPEN)
+        {
+            if (Chord->Window && BTN_ELAPSED(Now, Chord->FirstTick) > Chord->Window)
+            {
+                Chord->Phase = BTN_CHORD_EXPIRED;
+            }
+            else if (All)
+            {
+                Chord->Phase = BTN_CHORD_LATCHED;
+            }
+        }
+        else if (Chord->Phase == BTN_CHORD_LATCHED && !All)
+        {
+            Chord->Phase = Chord->Window ? BTN_CHORD_EXPIRED : BTN_CHORD_OPEN;
+        }
+    }
+
+    if (Chord->Suppress && Chord->Phase != BTN_CHORD_EXPIRED)
+    {
+        BTN_GPIO_PIN_T *Masks = (Chord->Phase == BTN_CHORD_LATCHED) ? Group->ChordMute : Group->ChordHold;
+
+        for (uint8_t Port = 0; Port < Group->PortsCount; Port++)
+        {
+            Masks[Port] |= Chord->Mask[Port];
+        }
+    }
+    ButtonProcess(&Chord->Key, Chord->Phase == BTN_CHORD_LATCHED, 1, Now);
+}
+
+/**
+ * @brief Runs all chords of a group after its buttons have been processed.
+ *
+ * The hold and mute masks are rebuilt for the next pass and the debounced
+ * pressed mask is cleared for it.
+ *
+ * @param Group Pointer to the group being processed.
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonGroupChords(button_group_t *Group, BTN_TIME_t Now)
+{
+    if (Group->ChordsCount == 0U)
+    {
+        return;
+    }
+
+    memset(Group->ChordHold, 0, sizeof(Group->ChordHold));
+    memset(Group->ChordMute, 0, sizeof(Group->ChordMute));
+    for (uint8_t i = 0; i < Group->ChordsCount; i++)
+    {
+        ButtonChordProcess(Group, &Group->Chords[i], Now);
+    }
+    memset(Group->ChordDown, 0, sizeof(Group->ChordDown));
+}
+#endif
+
+#if BTN_ENCODER
+/*
+ * Quadrature transitions indexed by `(previous A/B << 2) | current A/B`:
+ * +1 and -1 for the valid Gray code steps, 0 for no change and for the
+ * invalid double changes.
+ */
+static const int8_t BTN_EncoderTable[16] = {0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1, 0};
+
+/**
+ * @brief Reads the two-bit A/B level of an encoder from a port snapshot.
+ *
+ * @param Encoder Pointer to the encoder.
+ * @param Input Port snapshot of the group.
+ * @return Level of pin A in bit 1 and of pin B in bit 0.
+ */
+static uint8_t ButtonEncoderLevel(const button_encoder_t *Encoder, const BTN_GPIO_PIN_T *Input)
+{
+    return (uint8_t)((((Input[Encoder->IndexA] & Encoder->PinA) != 0U) ? 2U : 0U) |
+                     (((Input[Encoder->IndexB] & Encoder->PinB) != 0U) ? 1U : 0U));
+}
+
+/**
+ * @brief Returns the step multiplier of a new detent.
+ *
+ * @param Encoder Pointer to the encoder.
+ * @param Direction Direction of the new detent.
+ * @param Now Tick of the detent.
+ * @return Step of the last acceleration stage whose interval is above the time
+ * since the previous detent, 1 if none applies or the direction changed.
+ */
+static uint16_t ButtonEncoderStep(const button_encoder_t *Encoder, int8_t Direction, BTN_TIME_t Now)
+{
+    BTN_TIME_t Interval = BTN_ELAPSED(Now, Encoder->LastDetentTick);
+    uint16_t Step = 1;
+
+    if (Direction != Encoder->Direction)
+    {
+        return 1;
+    }
+    for (uint8_t i = 0; i < Encoder->AccelCount; i++)
+    {
+        if (Interval < Encoder->Accel[i].Interval)
+        {
+            Step = Encoder->Accel[i].Step;
+        }
+    }
+    return Step;
+}
+
+/**
+ * @brief Decodes one port snapshot for an encoder.
+ *
+ * One table lookup accumulates the transition; a full detent emits a rotate
+ * event through the encoder's virtual button.
+ *
+ * @param Encoder Pointer to the encoder.
+ * @param Input Port snapshot of the group.
+ * @param Now Tick at which the snapshot was taken.
+ *
+ * @return None
+ */
+static void ButtonEncoderProcess(button_encoder_t *Encoder, const BTN_GPIO_PIN_T *Input, BTN_TIME_t Now)
+{
+    uint8_t Level = ButtonEncoderLevel(Encoder, Input);
+    int8_t Direction;
+
+    Encoder->Quarter = (int8_t)(Encoder->Quarter + BTN_EncoderTable[(Encoder->State << 2) | Level]);
+    Encoder->State = Level;
+    if (Encoder->Quarter >= (int8_t)Encoder->StepsPerDetent)
+    {
+        Direction = 1;
+    }
+    else if (Encoder->Quarter <= -(int8_t)Encoder->StepsPerDetent)
+    {
+        Direction = -1;
+    }
+    else
+    {
+        return;
+    }
+
+    Encoder->Quarter = (int8_t)(Encoder->Quarter - Direction * (int8_t)Encoder->StepsPerDetent);
+    Encoder->Step = ButtonEncoderStep(Encoder, Direction, Now);
+    Encoder->Direction = Direction;
+    Encoder->LastDetentTick = Now;
+    ButtonEmit(&Encoder->Key, (Direction > 0) ? BTN_EVENT_ROTATE_CW : BTN_EVENT_ROTATE_CCW, Now);
+}
+#endif
+
+/**
+ * @brief Converts the pass input of a group into the pressed state of one of
+ * its buttons.
+ *
+ * @param Key Pointer to the button.
+ * @param Input Input of the pass per port: the raw snapshot, or the debounced
+ * pressed mask when `Debounced` is set.
+ * @param Debounced Non-zero if `Input` is the debounced pressed mask (polarity
+ * already applied).
+ * @return Logical pressed state of the button.
+ */
+static uint8_t ButtonGroupKeyActive(const button_t *Key, const BTN_GPIO_PIN_T *Input, uint8_t Debounced)
+{
+    uint8_t PinState = ((Input[Key->PortIndex] & Key->GpioPin) != 0U) ? BTN_SET : BTN_RESET;
+
+    if (Debounced)
+    {
+        return PinState == BTN_SET;
+    }
+    return ButtonIsActive(Key, PinState);
+}
+
+/**
+ * @brief Runs one button of a group on its sampled input.
+ *
+ * With chords attached to the group, the button is muted or has its held
+ * back press delivered according to the masks of the previous chord pass, and
+ * its accepted press is recorded in the debounced pressed mask.
+ *
+ * @param Group Pointer to the group owning the button.
+ * @param Key Pointer to the button being processed.
+ * @param Active Logical pressed state of the button in this pass.
+ * @param Debounced Non-zero if `Active` comes from an already debounced source.
+ * @param Now Tick of the current pass.
+ *
+ * @return None
+ */
+static void ButtonGroupProcessKey(button_group_t *Group, button_t *Key, uint8_t Active, uint8_t Debounced,
+                                  BTN_TIME_t Now)
+{
+#if BTN_CHORD
+    BTN_GPIO_PIN_T Pin = Key->GpioPin;
+    uint8_t Port = Key->PortIndex;
+
+    if (Group->ChordsCount == 0U)
+    {
+        ButtonProcess(Key, Active, Debounced, Now);
+        return;
+    }
+
+    if ((Group->ChordMute[Port] & Pin) != 0U)
+    {
+        Key->ChordMuted = 1;
+        Key->ChordPending = 0;
+    }
+    ButtonProcess(Key, Active, Debounced, Now);
+    if (Key->ChordPending && (Group->ChordHold[Port] & Pin) == 0U)
+    {
+        Key->ChordPending = 0;
+        ButtonDeliver(Key, BTN_EVENT_PRESSED, Now);
+    }
+    if (ButtonIsDown(Key))
+    {
+        Group->ChordDown[Port] |= Pin;
+    }
+    else if (Key->State == IDLE)
+    {
+        Key->ChordMuted = 0;
+    }
+#else
+    (void)Group;
+    ButtonProcess(Key, Active, Debounced, Now);
+#endif
+}
+
+#if BTN_GROUP_ACTIVE_LIST
+/**
+ * @brief Decides whether a processed button leaves the busy bitmap.
+ *
+ * A button stays busy while it waits for a chord decision, is held as a chord
+ * member, is idle with its input already pressed (e.g. pressed again before
+ * the pass that ended its release), or cannot be woken by a change of its pin
+ * alone (a pin mask with more than one bit, a pin shared with an earlier
+ * button of the group, or edge wake-up mode). Otherwise:
+ * - With `BTN_GROUP_TIMER_HEAP`, a button with a future deadline (see
+ * `ButtonTimeToDeadline()`) is parked in the timer heap and a button in
+ * `IDLE` without one leaves the bitmap; a due deadline keeps it busy.
+ * - Without it, only a button in `IDLE` with no pending multiple click,
+ * non-used or lockout timer leaves the bitmap. The timers are tested by their
+ * flags only, since the idle pass that just ran has already ended an expired
+ * lockout.
+ *
+ * A button leaving the bitmap stops its `MaxTaskGap` measurement, since it is
+ * no longer processed on every pass.
+ *
+ * @param Group Pointer to the group owning the button.
+ * @param Index Index of the button in `Group->Keys`.
+ * @param Active Logical pressed state of the button in this pass.
+ * @param Now Tick of the current pass.
+ * @return 1 if the button leaves the busy bitmap, 0 if it stays busy.
+ */
+static uint8_t ButtonGroupKeySettle(button_group_t *Group, uint16_t Index, uint8_t Active, BTN_TIME_t Now)
+{
+    button_t *Key = &Group->Keys[Index];
+    BTN_GPIO_PIN_T Pin = Key->GpioPin;
+#if BTN_GROUP_TIMER_HEAP
+    BTN_TIME_t Left;
+#endif
+
+    if (Key->State == IDLE && Active)
+    {
+        return 0;
+    }
+#if !BTN_GROUP_TIMER_HEAP
+    (void)Now;
+    if (Key->State != IDLE)
+    {
+        return 0;
+    }
+#if BTN_NON_USED_CALLBACK
+    if (BTN_CFG(Key)->TimerNonUsed)
+    {
+        return 0;
+    }
+#endif
+#if BTN_MULTIPLE_CLICK
+    if (BTN_CFG(Key)->MultipleClickMode == BTN_MULTIPLE_CLICK_COMBINED_MODE && Key->ClickCounter != 0)
+    {
+        return 0;
+    }
+#endif
+#if BTN_LEADING_EDGE
+    if (Key->Lockout)
+    {
+        return 0;
+    }
+#endif
+#endif
+#if BTN_CHORD
+    if (Key->ChordPending || (Group->ChordsCount != 0U && ButtonIsDown(Key)))
+    {
+        return 0;
+    }
+#endif
+#if BTN_EDGE_WAKEUP
+    if (Key->EdgeWakeup)
+    {
+        return 0;
+    }
+#endif
+    if (Pin == 0U || (Pin & (BTN_GPIO_PIN_T)(Pin - 1U)) != 0U ||
+        Group->PinKey[Key->PortIndex][ButtonBitIndex((uint32_t)Pin)] != Index + 1U)
+    {
+        return 0;
+    }
+#if BTN_GROUP_TIMER_HEAP
+    Left = ButtonTimeToDeadline(Key, Now);
+    if (Left == 0U)
+    {
+        return 0;
+    }
+    if (Left != BTN_MAX_TIMEOUT || Key->State != IDLE)
+    {
+        ButtonTimerPark(Group, Index, (BTN_TIME_t)(Now + Left));
+    }
+#endif
+#if BTN_STATS
+    Key->StatsRunning = 0;
+#endif
+    return 1;
+}
+#endif
+
+#if BTN_ATOMIC_CONFIG
+/**
+ * @brief Adopts the configurations published for a group's buttons.
+ *
+ * A button adopts its own configuration when it is run, but parked and idle
+ * buttons are not run. So whenever the publish counter moved, all buttons and
+ * chords of the group adopt theirs, and all buttons are woken to re-evaluate
+ * their timers. The check costs one load per pass otherwise.
+ *
+ * @param Group Pointer to the group being processed.
+ *
+ * @return None
+ */
+static void ButtonGroupAdoptConfig(button_group_t *Group)
+{
+    uint16_t Serial = BTN_ConfigSerial;
+
+    if (Serial == Group->ConfigSerial)
+    {
+        return;
+    }
+
+    Group->ConfigSerial = Serial;
+    BTN_MEMORY_BARRIER();
+    for (uint16_t i = 0; i < Group->KeysCount; i++)
+    {
+        ButtonConfigAdopt(&Group->Keys[i]);
+    }
+#if BTN_CHORD
+    for (uint8_t i = 0; i < Group->ChordsCount; i++)
+    {
+        ButtonConfigAdopt(&Group->Chords[i].Key);
+    }
+#endif
+#if BTN_ENCODER
+    for (uint8_t i = 0; i < Group->EncodersCount; i++)
+    {
+        ButtonConfigAdopt(&Group->Encoders[i].Key);
+    }
+#endif
+#if BTN_GROUP_ACTIVE_LIST
+    ButtonGroupWakeAll(Group);
+#endif
+}
+#endif
+
+#if BTN_CAPTURE
+/**
+ * @brief Stores one record in a capture ring buffer.
+ *
+ * When the ring is full, the oldest record is overwritten and its value
+ * becomes the base level of its port.
+ *
+ * @param Capture Pointer to the capture.
+ * @param Delta Ticks since the previous record.
+ * @param Port Index of the port.
+ * @param Value New value of the port.
+ *
+ * @return None
+ */
+static void ButtonCapturePush(button_capture_t *Capture, uint16_t Delta, uint8_t Port, BTN_GPIO_PIN_T Value)
+{
+    button_capture_record_t *Record = &Capture->Records[Capture->Head];
+
+    if (Capture->Count == Capture->Capacity)
+    {
+        Capture->Base[Record->Port] = Record->Value;
+    }
+    else
+    {
+        Capture->Count++;
+    }
+    Record->Delta = Delta;
+    Record->Port = Port;
+    Record->Value = Value;
+    Capture->Head = (uint16_t)(Capture->Head + 1U);
+    if (Capture->Head == Capture->Capacity)
+    {
+        Capture->Head = 0;
+    }
+}
+
+/**
+ * @brief Records one port snapshot of a group.
+ *
+ * The first snapshot only sets the initial levels; afterwards one record is
+ * stored per changed port, so an unchanged snapshot costs one compare per
+ * port.
+ *
+ * Ports added to the group later (e.g. by `ButtonGroupSetEncoders()`) join the
+ * capture at the snapshot that first contains them; their base level is the
+ * level of that snapshot. A group with fewer ports than the capture has been
+ * re-initialized, so the capture restarts from its snapshot.
+ *
+ * @param Capture Pointer to the capture.
+ * @param PortState Port snapshot.
+ * @param PortsCount Number of ports in `PortState`.
+ * @param Now Tick at which the snapshot was taken.
+ *
+ * @return None
+ */
+static void ButtonCaptureSample(button_capture_t *Capture, const BTN_GPIO_PIN_T *PortState, uint8_t PortsCount,
+                                BTN_TIME_t Now)
+{
+    if (Capture->Frozen != 0U)
+    {
+        return;
+    }
+    if (PortsCount < Capture->PortsCount)
+    {
+        Capture->Head = 0;
+        Capture->Count = 0;
+        Capture->PortsCount = 0;
+    }
+    if (PortsCount != Capture->PortsCount)
+    {
+        if (Capture->PortsCount == 0U)
+        {
+            Capture->LastTick = Now;
+        }
+        for (uint8_t Port = Capture->PortsCount; Port < PortsCount; Port++)
+        {
+            Capture->Level[Port] = PortState[Port];
+            Capture->Base[Port] = PortState[Port];
+        }
+        Capture->PortsCount = PortsCount;
+    }
+
+    for (uint8_t Port = 0; Port < Capture->PortsCount; Port++)
+    {
+        BTN_TIME_t Delta;
+
+        if (PortState[Port] == Capture->Level[Port])
+        {
+            continue;
+        }
+        Delta = BTN_ELAPSED(Now, Capture->LastTick);
+#if BTN_MAX_TIMEOUT > UINT16_MAX
+        while (Delta > UINT16_MAX)
+        {
+            ButtonCapturePush(Capture, UINT16_MAX, Port, Capture->Level[Port]);
+            Delta = (BTN_TIME_t)(Delta - UINT16_MAX);
+        }
+#endif
+        ButtonCapturePush(Capture, (uint16_t)Delta, Port, PortState[Port]);
+        Capture->Level[Port] = PortState[Port];
+        Capture->LastTick = Now;
+    }
+}
+#endif
+
+/**
+ * @brief Runs all buttons of a group on the snapshot stored in `PortState`.
+ *
+ * With vertical debouncing enabled, feeds the snapshot into the counters (once
+ * per `SamplePeriod`) and runs every button on its bit of the debounced
+ * `Pressed` mask. Otherwise, for each button, masks its pin out of the
+ * snapshot, converts it into the logical pressed state and runs one step of
+ * the state machine. With `BTN_GROUP_ACTIVE_LIST`, only the busy buttons, the
+ * buttons whose input changed since the previous pass and (with
+ * `BTN_GROUP_TIMER_HEAP`) the parked buttons whose deadline has been reached
+ * are run, in the order of `Keys`. Chords and then encoders (decoded from the
+ * raw snapshot) follow. A suspended group (`BTN_GROUP_SUSPEND`) is not
+ * processed.
+ *
+ * @param Group Pointer to the group being processed.
+ * @param Now Tick at which the snapshot was taken.
+ *
+ * @return None
+ */
+static void ButtonGroupProcessSnapshot(button_group_t *Group, BTN_TIME_t Now)
+{
+    const BTN_GPIO_PIN_T *Input = Group->PortState;
+    uint8_t Debounced = 0;
+
+#if BTN_GROUP_SUSPEND
+    if (Group->Suspended)
+    {
+        return;
+    }
+#endif
+#if BTN_CAPTURE
+    if (Group->Capture != NULL)
+    {
+        ButtonCaptureSample(Group->Capture, Input, Group->PortsCount, Now);
+    }
+#endif
+#if BTN_ATOMIC_CONFIG
+    ButtonGroupAdoptConfig(Group);
+#endif
+#if BTN_GROUP_VERTICAL_DEBOUNCE
+    if (Group->VerticalDebounce)
+    {
+        if (BTN_ELAPSED(Now, Group->LastSampleTick) >= Group->SamplePeriod)
+        {
+            Group->LastSampleTick = Now;
+            ButtonGroupVerticalSample(Group);
+        }
+        Input = Group->Pressed;
+        Debounced = 1;
+    }
+#endif
+
+#if BTN_GROUP_ACTIVE_LIST
+    ButtonGroupWakeChanged(Group, Input);
+#if BTN_GROUP_TIMER_HEAP
+    ButtonGroupWakeDue(Group, Now);
+#endif
+    for (uint16_t Word = 0; Word < (uint16_t)((Group->KeysCount + 31U) >> 5); Word++)
+    {
+        uint32_t Busy = Group->Busy[Word];
+
+        while (Busy != 0U)
+        {
+            uint32_t Bit = Busy & (~Busy + 1U);
+            uint16_t i = (uint16_t)((Word << 5) + ButtonBitIndex(Bit));
+            uint8_t Active = ButtonGroupKeyActive(&Group->Keys[i], Input, Debounced);
+
+            Busy ^= Bit;
+            ButtonGroupProcessKey(Group, &Group->Keys[i], Active, Debounced, Now);
+            if (ButtonGroupKeySettle(Group, i, Active, Now))
+            {
+                Group->Busy[Word] &= ~Bit;
+            }
+        }
+    }
+#else
+    for (uint16_t i = 0; i < Group->KeysCount; i++)
+    {
+        ButtonGroupProcessKey(Group, &Group->Keys[i], ButtonGroupKeyActive(&Group->Keys[i], Input, Debounced),
+                              Debounced, Now);
+    }
+#endif
+#if BTN_CHORD
+    ButtonGroupChords(Group, Now);
+#endif
+#if BTN_ENCODER
+    for (uint8_t i = 0; i < Group->EncodersCount; i++)
+    {
+        ButtonEncoderProcess(&Group->Encoders[i], Group->PortState, Now);
+    }
+#endif
+}
+
+/**
+ * @brief Handles the state machines of all buttons in a group.
+ *
+ * Actions performed:
+ * - Reads every distinct port of the group once into `PortState`.
+ * - If vertical debouncing is enabled, feeds the snapshot into the vertical
+ * counters (once per `SamplePeriod`) and runs every button on its bit of the
+ * debounced `Pressed` mask.
+ * - Otherwise, for each button, masks its pin out of the snapshot, converts it
+ * into the logical pressed state and runs one step of the state machine.
+ *
+ * @param Group Pointer to the group being processed.
+ * @return Status of the group task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonGroupTask(button_group_t *Group)
+{
+    return ButtonGroupTaskAt(Group, BTN_GET_TICK);
+}
+
+/**
+ * @brief Processes all buttons of a group at an explicitly given tick.
+ *
+ * Same as `ButtonGroupTask()`, but the registered tick source is not sampled.
+ *
+ * @param Group Pointer to the group being processed.
+ * @param Now Current tick.
+ * @return Status of the group task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonGroupTaskAt(button_group_t *Group, BTN_TIME_t Now)
+{
+    if (Group == NULL || Group->Keys == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    for (uint8_t Port = 0; Port < Group->PortsCount; Port++)
+    {
+        Group->PortState[Port] = ReadPort(Group->Ports[Port]);
+    }
+    ButtonGroupProcessSnapshot(Group, Now);
+    return BTN_OK;
+}
+
+/**
+ * @brief Processes a block of port snapshots captured by DMA.
+ *
+ * Same as `ButtonGroupProcessBlockAt()`, with the last sample of the block
+ * taken at the current tick.
+ *
+ * @param Group Pointer to the group being processed.
+ * @param PortSamples One sample buffer per group port, in the order of
+ * `Group->Ports`.
+ * @param SamplesCount Number of samples in every buffer.
+ * @param SamplePeriod Ticks between two consecutive samples.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the block was processed successfully.
+ *         - `BTN_ERROR` if there was an error during processing.
+ */
+BTN_operate_status ButtonGroupProcessBlock(button_group_t *Group, const BTN_GPIO_PIN_T *const *PortSamples,
+                                           uint16_t SamplesCount, BTN_TIME_t SamplePeriod)
+{
+    return ButtonGroupProcessBlockAt(Group, PortSamples, SamplesCount, SamplePeriod, BTN_GET_TICK);
+}
+
+/**
+ * @brief Processes a block of port snapshots captured by DMA at an explicitly
+ * given tick.
+ *
+ * Intended for a timer-triggered DMA that copies the input register of every
+ * group port into a circular buffer at a fixed rate. From its half/full
+ * transfer interrupt, the application passes the completed half of each
+ * buffer; every sample is then fed through the state machines of all buttons
+ * exactly as if `ButtonGroupTask()` had read it, at the tick the sample was
+ * taken. Sample `k` of `SamplesCount` is timed at
+ * `Now - (SamplesCount - 1 - k) * SamplePeriod`.
+ *
+ * @param Group Pointer to the group being processed.
+ * @param PortSamples One sample buffer per group port, in the order of
+ * `Group->Ports`.
+ * @param SamplesCount Number of samples in every buffer.
+ * @param SamplePeriod Ticks between two consecutive samples.
+ * @param Now Tick of the last sample of the block.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the block was processed successfully.
+ *         - `BTN_ERROR` if there was an error during processing.
+ */
+BTN_operate_status ButtonGroupProcessBlockAt(button_group_t *Group, const BTN_GPIO_PIN_T *const *PortSamples,
+                                             uint16_t SamplesCount, BTN_TIME_t SamplePeriod, BTN_TIME_t Now)
+{
+    BTN_TIME_t SampleTick;
+
+    if (Group == NULL || Group->Keys == NULL || PortSamples == NULL || SamplesCount == 0U)
+    {
+        return BTN_ERROR;
+    }
+
+    for (uint8_t Port = 0; Port < Group->PortsCount; Port++)
+    {
+        if (PortSamples[Port] == NULL)
+        {
+            return BTN_ERROR;
+        }
+    }
+
+    SampleTick = (BTN_TIME_t)(Now - (BTN_TIME_t)((SamplesCount - 1U) * SamplePeriod));
+    for (uint16_t Sample = 0; Sample < SamplesCount; Sample++)
+    {
+        for (uint8_t Port = 0; Port < Group->PortsCount; Port++)
+        {
+            Group->PortState[Port] = PortSamples[Port][Sample];
+        }
+        ButtonGroupProcessSnapshot(Group, SampleTick);
+        SampleTick = (BTN_TIME_t)(SampleTick + SamplePeriod);
+    }
+    return BTN_OK;
+}
+
+#if BTN_EDGE_WAKEUP
+/**
+ * @brief Reports input edges on a set of pins to the buttons of a group.
+ *
+ * Every button of the group connected to `Port` whose pin is in `Pins` gets
+ * its edge flag set, as with `ButtonNotifyEdge()`. Safe to call from an
+ * interrupt handler.
+ *
+ * @param Group Pointer to the group.
+ * @param Port GPIO port of the edges, or NULL to match the pins on any port
+ * (EXTI lines are usually shared by the same pin number of all ports).
+ * @param Pins Mask of the pins that saw an edge.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGroupNotifyEdge(button_group_t *Group, BTN_GPIO_PORT_T *Port, BTN_GPIO_PIN_T Pins)
+{
+    if (Group == NULL || Group->Keys == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    for (uint16_t i = 0; i < Group->KeysCount; i++)
+    {
+        button_t *Key = &Group->Keys[i];
+
+        if ((Key->GpioPin & Pins) != 0U && (Port == NULL || Key->GpioPort == Port))
+        {
+            Key->EdgePending = 1;
+        }
+    }
+    return BTN_OK;
+}
+#endif
+
+/**
+ * @brief Reports the time until the next timer-driven state change of any
+ * button in a group.
+ *
+ * Returns the minimum of the per-button deadlines (see
+ * `ButtonGetNextDeadline()`). With vertical debouncing enabled, a pin whose
+ * counter is still running also requests the next debounce sample. With
+ * `BTN_GROUP_ACTIVE_LIST` only the busy buttons are visited (idle buttons have
+ * no deadline), and with `BTN_GROUP_TIMER_HEAP` the earliest deadline of the
+ * parked buttons is read from the top of the heap.
+ *
+ * @param Group Pointer to the group.
+ * @param Ticks Output: ticks until the next deadline, or `BTN_MAX_TIMEOUT` if
+ * no button of the group has a pending timer.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGroupGetNextDeadline(const button_group_t *Group, BTN_TIME_t *Ticks)
+{
+    BTN_TIME_t Now;
+    BTN_TIME_t Left = BTN_MAX_TIMEOUT;
+
+    if (Group == NULL || Group->Keys == NULL || Ticks == NULL)
+    {
+        return BTN_ERROR;
+    }
+#if BTN_GROUP_SUSPEND
+    if (Group->Suspended)
+    {
+        *Ticks = BTN_MAX_TIMEOUT;
+        return BTN_OK;
+    }
+#endif
+
+    Now = BTN_GET_TICK;
+#if BTN_GROUP_ACTIVE_LIST
+    for (uint16_t Word = 0; Word < (uint16_t)((Group->KeysCount + 31U) >> 5); Word++)
+    {
+        uint32_t Busy = Group->Busy[Word];
+
+        while (Busy != 0U)
+        {
+            uint32_t Bit = Busy & (~Busy + 1U);
+            BTN_TIME_t KeyLeft = ButtonTimeToDeadline(&Group->Keys[(Word << 5) + ButtonBitIndex(Bit)], Now);
+
+            Busy ^= Bit;
+            if (KeyLeft < Left)
+            {
+                Left = KeyLeft;
+            }
+        }
+    }
+#if BTN_GROUP_TIMER_HEAP
+    if (Group->TimersCount != 0U)
+    {
+        BTN_TIME_t Rank = ButtonTimerRank(Group, 0);
+        BTN_TIME_t Elapsed = BTN_ELAPSED(Now, Group->TimerBase);
+        BTN_TIME_t Parked = (Rank > Elapsed) ? (BTN_TIME_t)(Rank - Elapsed) : 0U;
+
+        if (Parked < Left)
+        {
+            Left = Parked;
+        }
+    }
+#endif
+#if BTN_GROUP_VERTICAL_DEBOUNCE
+    for (uint8_t Port = 0; Group->VerticalDebounce && Port < Group->PortsCount; Port++)
+    {
+        if ((Group->Pins[Port] & (BTN_GPIO_PIN_T)~(Group->CounterLow[Port] & Group->CounterHigh[Port])) != 0U)
+        {
+            BTN_TIME_t Sample = ButtonTimeLeft(Group->LastSampleTick, Group->SamplePeriod, Now);
+
+            if (Sample < Left)
+            {
+                Left = Sample;
+            }
+            break;
+        }
+    }
+#endif
+#else
+    for (uint16_t i = 0; i < Group->KeysCount; i++)
+    {
+        const button_t *Key = &Group->Keys[i];
+        BTN_TIME_t KeyLeft = ButtonTimeToDeadline(Key, Now);
+
+#if BTN_GROUP_VERTICAL_DEBOUNCE
+        if (Group->VerticalDebounce &&
+            (Group->CounterLow[Key->PortIndex] & Group->CounterHigh[Key->PortIndex] & Key->GpioPin) != Key->GpioPin)
+        {
+            BTN_TIME_t Sample = ButtonTimeLeft(Group->LastSampleTick, Group->SamplePeriod, Now);
+
+            if (Sample < KeyLeft)
+            {
+                KeyLeft = Sample;
+            }
+        }
+#endif
+        if (KeyLeft < Left)
+        {
+            Left = KeyLeft;
+        }
+    }
+#endif
+#if BTN_CHORD
+    for (uint8_t i = 0; i < Group->ChordsCount; i++)
+    {
+        const button_chord_t *Chord = &Group->Chords[i];
+        BTN_TIME_t ChordLeft = ButtonTimeToDeadline(&Chord->Key, Now);
+
+        if (Chord->Phase == BTN_CHORD_OPEN && Chord->Window)
+        {
+            BTN_TIME_t Window = ButtonTimeLeft(Chord->FirstTick, (BTN_TIME_t)(Chord->Window + 1U), Now);
+
+            if (Window < ChordLeft)
+            {
+                ChordLeft = Window;
+            }
+        }
+        if (ChordLeft < Left)
+        {
+            Left = ChordLeft;
+        }
+    }
+#endif
+    *Ticks = Left;
+    return BTN_OK;
+}
+
+#if BTN_GROUP_SUSPEND
+/**
+ * @brief Moves all stored timestamps of a button forward.
+ *
+ * `PressTime` is only a timestamp while the button is held; in the release
+ * states it already holds the press duration and is left alone.
+ *
+ * @param Key Pointer to the button.
+ * @param Elapsed Ticks to add.
+ *
+ * @return None
+ */
+static void ButtonRebase(button_t *Key, BTN_TIME_t Elapsed)
+{
+    Key->LastTick = (BTN_TIME_t)(Key->LastTick + Elapsed);
+#if BTN_DOUBLE_DEBOUNCING
+    Key->LastTickSecondDebounce = (BTN_TIME_t)(Key->LastTickSecondDebounce + Elapsed);
+#endif
+#if BTN_MULTIPLE_CLICK
+    Key->LastClickTick = (BTN_TIME_t)(Key->LastClickTick + Elapsed);
+#endif
+#if BTN_ADAPTIVE_DEBOUNCE
+    Key->AdaptEdge = (BTN_TIME_t)(Key->AdaptEdge + Elapsed);
+#endif
+#if BTN_LEADING_EDGE
+    Key->LockoutTick = (BTN_TIME_t)(Key->LockoutTick + Elapsed);
+#endif
+#if BTN_EVENT_PRESS_INFO
+    if (Key->State == PRESSED || Key->State == REPEAT
+#if BTN_DOUBLE_DEBOUNCING
+        || Key->State == DEBOUNCE_RELEASE
+#endif
+    )
+    {
+        Key->PressTime = (BTN_TIME_t)(Key->PressTime + Elapsed);
+    }
+#endif
+#if BTN_STATS
+    Key->StatsLastTick = (BTN_TIME_t)(Key->StatsLastTick + Elapsed);
+    Key->StatsPressTick = (BTN_TIME_t)(Key->StatsPressTick + Elapsed);
+#endif
+}
+
+/**
+ * @brief Suspends a group before a low-power mode.
+ *
+ * @param Group Pointer to the group.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGroupSuspend(button_group_t *Group)
+{
+    if (Group == NULL || Group->Keys == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    Group->Suspended = 1;
+    return BTN_OK;
+}
+
+/**
+ * @brief Resumes a suspended group.
+ *
+ * Rebases the timestamps of all buttons, chords and encoders by `Elapsed`,
+ * moves the wake-up button into `DEBOUNCE` and, with `BTN_GROUP_ACTIVE_LIST`,
+ * wakes all buttons so the first pass after the sleep sees every input.
+ *
+ * @param Group Pointer to the suspended group.
+ * @param Elapsed Ticks the tick source advanced while suspended that must not
+ * count.
+ * @param WakeKey Button of the group that caused the wake-up, or NULL.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGroupResume(button_group_t *Group, BTN_TIME_t Elapsed, button_t *WakeKey)
+{
+    if (Group == NULL || Group->Keys == NULL ||
+        (WakeKey != NULL && (WakeKey < Group->Keys || WakeKey >= &Group->Keys[Group->KeysCount])))
+    {
+        return BTN_ERROR;
+    }
+
+    for (uint16_t i = 0; i < Group->KeysCount; i++)
+    {
+        ButtonRebase(&Group->Keys[i], Elapsed);
+    }
+#if BTN_CHORD
+    for (uint8_t i = 0; i < Group->ChordsCount; i++)
+    {
+        ButtonRebase(&Group->Chords[i].Key, Elapsed);
+        Group->Chords[i].FirstTick = (BTN_TIME_t)(Group->Chords[i].FirstTick + Elapsed);
+    }
+#endif
+#if BTN_ENCODER
+    for (uint8_t i = 0; i < Group->EncodersCount; i++)
+    {
+        Group->Encoders[i].LastDetentTick = (BTN_TIME_t)(Group->Encoders[i].LastDetentTick + Elapsed);
+    }
+#endif
+#if BTN_GROUP_VERTICAL_DEBOUNCE
+    Group->LastSampleTick = (BTN_TIME_t)(Group->LastSampleTick + Elapsed);
+#endif
+#if BTN_GROUP_TIMER_HEAP
+    Group->TimerBase = (BTN_TIME_t)(Group->TimerBase + Elapsed);
+#endif
+#if BTN_CAPTURE
+    if (Group->Capture != NULL)
+    {
+        Group->Capture->LastTick = (BTN_TIME_t)(Group->Capture->LastTick + Elapsed);
+    }
+#endif
+
+    if (WakeKey != NULL && WakeKey->State == IDLE)
+    {
+#if BTN_EDGE_WAKEUP
+        WakeKey->Asleep = 0;
+        WakeKey->EdgePending = 0;
+#endif
+#if BTN_GROUP_VERTICAL_DEBOUNCE
+        if (!Group->VerticalDebounce)
+#endif
+        {
+            ButtonDebounceBegin(WakeKey, BTN_GET_TICK);
+        }
+    }
+#if BTN_GROUP_ACTIVE_LIST
+    ButtonGroupWakeAll(Group);
+#endif
+    Group->Suspended = 0;
+    return BTN_OK;
+}
+#endif
+
+#if BTN_GROUP_VERTICAL_DEBOUNCE
+/**
+ * @brief Enables or disables bit-parallel debouncing for a button group.
+ *
+ * Resets the vertical counters and the debounced pressed mask (all buttons are
+ * assumed released; a held button is picked up after 4 samples).
+ *
+ * @param Group Pointer to the group structure.
+ * @param Enable 1 to enable the vertical counters, 0 to return to per-button
+ * debouncing.
+ * @param SamplePeriod Time in milliseconds between two samples (0 samples on
+ * every `ButtonGroupTask()` call).
+ * @return Status of the configuration:
+ *         - `BTN_OK` if the configuration was successful.
+ *         - `BTN_ERROR` if there was an error during configuration.
+ */
+BTN_operate_status ButtonGroupSetVerticalDebounce(button_group_t *Group, uint8_t Enable, BTN_TIME_t SamplePeriod)
+{
+    if (Group == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    for (uint8_t Port = 0; Port < BTN_GROUP_MAX_PORTS; Port++)
+    {
+        Group->Pressed[Port] = 0;
+        Group->Changed[Port] = 0;
+        Group->CounterLow[Port] = (BTN_GPIO_PIN_T)~0U;
+        Group->CounterHigh[Port] = (BTN_GPIO_PIN_T)~0U;
+    }
+    Group->SamplePeriod = SamplePeriod;
+    Group->LastSampleTick = BTN_GET_TICK;
+    Group->VerticalDebounce = Enable;
+#if BTN_GROUP_ACTIVE_LIST
+    ButtonGroupWakeAll(Group);
+#endif
+    return BTN_OK;
+}
+#endif
+
+#if BTN_CHORD
+/**
+ * @brief Initializes a chord over buttons of a group.
+ *
+ * Builds the per-port member mask from the members' pins and port indexes and
+ * marks the members of a suppressing chord, so that their presses are held
+ * back while the chord is undecided.
+ *
+ * @param Chord Pointer to the chord structure to initialize.
+ * @param Members Array of pointers to the member buttons.
+ * @param MembersCount Number of members (at least 2).
+ * @param Window Maximum time between the first and the last member press, or 0
+ * for no limit.
+ * @param Suppress Non-zero to suppress the members' own events.
+ * @param Config Configuration of the chord's events and timings.
+ * @param Number Identifier of the chord passed to callbacks.
+ * @return Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if an error occurs during initialization.
+ */
+BTN_operate_status ButtonChordInit(button_chord_t *Chord, button_t *const *Members, uint8_t MembersCount,
+                                   BTN_TIME_t Window, uint8_t Suppress, const button_config_t *Config,
+                                   uint16_t Number)
+{
+    if (Chord == NULL || Members == NULL || MembersCount < 2U ||
+        ButtonInitKeyBit(&Chord->Key, 0, Config, Number) != BTN_OK)
+    {
+        return BTN_ERROR;
+    }
+
+    memset(Chord->Mask, 0, sizeof(Chord->Mask));
+    for (uint8_t i = 0; i < MembersCount; i++)
+    {
+        if (Members[i] == NULL || Members[i]->GpioPort == NULL || Members[i]->PortIndex >= BTN_GROUP_MAX_PORTS)
+        {
+            return BTN_ERROR;
+        }
+        Chord->Mask[Members[i]->PortIndex] |= Members[i]->GpioPin;
+    }
+    for (uint8_t i = 0; i < MembersCount; i++)
+    {
+        Members[i]->ChordHold |= (Suppress != 0U);
+    }
+
+    Chord->Window = Window;
+    Chord->FirstTick = 0;
+    Chord->Phase = BTN_CHORD_IDLE;
+    Chord->Suppress = Suppress;
+    return BTN_OK;
+}
+
+/**
+ * @brief Attaches an array of chords to a group.
+ *
+ * All chords start idle; the members of suppressing chords are put in the hold
+ * mask right away, so a press in the first pass is already held back.
+ *
+ * @param Group Pointer to the group.
+ * @param Chords Array of initialized chords.
+ * @param ChordsCount Number of chords.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGroupSetChords(button_group_t *Group, button_chord_t *Chords, uint8_t ChordsCount)
+{
+    if (Group == NULL || (Chords == NULL && ChordsCount != 0U))
+    {
+        return BTN_ERROR;
+    }
+
+    memset(Group->ChordDown, 0, sizeof(Group->ChordDown));
+    memset(Group->ChordHold, 0, sizeof(Group->ChordHold));
+    memset(Group->ChordMute, 0, sizeof(Group->ChordMute));
+    for (uint8_t i = 0; i < ChordsCount; i++)
+    {
+        Chords[i].Phase = BTN_CHORD_IDLE;
+#if BTN_EVENT_QUEUE && (BTN_EVENT_QUEUE_COUNT > 1)
+        Chords[i].Key.Queue = Group->Queue;
+#endif
+        for (uint8_t Port = 0; Port < BTN_GROUP_MAX_PORTS; Port++)
+        {
+            if (Chords[i].Suppress)
+            {
+                Group->ChordHold[Port] |= Chords[i].Mask[Port];
+            }
+        }
+    }
+    Group->Chords = Chords;
+    Group->ChordsCount = ChordsCount;
+#if BTN_GROUP_ACTIVE_LIST
+    ButtonGroupWakeAll(Group);
+#endif
+    return BTN_OK;
+}
+#endif
+
+#if BTN_ENCODER
+/**
+ * @brief Initializes a quadrature rotary encoder.
+ *
+ * The virtual button is set up like a chord's, through `ButtonInitKeyBit()`;
+ * the pins are resolved to group ports by `ButtonGroupSetEncoders()`.
+ *
+ * @param Encoder Pointer to the encoder structure to initialize.
+ * @param PortA GPIO port of pin A.
+ * @param PinA Mask of pin A.
+ * @param PortB GPIO port of pin B.
+ * @param PinB Mask of pin B.
+ * @param StepsPerDetent Gray code transitions per detent (1, 2 or 4).
+ * @param Config Configuration of the encoder's events.
+ * @param Number Identifier of the encoder passed to callbacks.
+ * @return Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if an error occurs during initialization.
+ */
+BTN_operate_status ButtonEncoderInit(button_encoder_t *Encoder, BTN_GPIO_PORT_T *PortA, BTN_GPIO_PIN_T PinA,
+                                     BTN_GPIO_PORT_T *PortB, BTN_GPIO_PIN_T PinB, uint8_t StepsPerDetent,
+                                     const button_config_t *Config, uint16_t Number)
+{
+    if (Encoder == NULL || PortA == NULL || PortB == NULL || PinA == 0U || PinB == 0U ||
+        (StepsPerDetent != 1U && StepsPerDetent != 2U && StepsPerDetent != 4U) ||
+        ButtonInitKeyBit(&Encoder->Key, 0, Config, Number) != BTN_OK)
+    {
+        return BTN_ERROR;
+    }
+
+    Encoder->PortA = PortA;
+    Encoder->PortB = PortB;
+    Encoder->PinA = PinA;
+    Encoder->PinB = PinB;
+    Encoder->IndexA = 0;
+    Encoder->IndexB = 0;
+    Encoder->State = 0;
+    Encoder->StepsPerDetent = StepsPerDetent;
+    Encoder->Quarter = 0;
+    Encoder->Direction = 0;
+    Encoder->Step = 1;
+    Encoder->LastDetentTick = 0;
+    Encoder->Accel = NULL;
+    Encoder->AccelCount = 0;
+    return BTN_OK;
+}
+
+/**
+ * @brief Sets the velocity-based acceleration of an encoder.
+ *
+ * @param Encoder Pointer to the encoder.
+ * @param Stages Acceleration stages by decreasing `Interval`, or NULL for a
+ * constant step of 1.
+ * @param StagesCount Number of stages.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonEncoderSetAcceleration(button_encoder_t *Encoder, const button_encoder_accel_t *Stages,
+                                                uint8_t StagesCount)
+{
+    if (Encoder == NULL || (Stages == NULL && StagesCount != 0U))
+    {
+        return BTN_ERROR;
+    }
+
+    Encoder->Accel = Stages;
+    Encoder->AccelCount = (Stages != NULL) ? StagesCount : 0U;
+    return BTN_OK;
+}
+
+/**
+ * @brief Attaches an array of encoders to a group.
+ *
+ * Resolves the encoder pins to group ports (adding missing ports) and takes the
+ * current pin levels as starting positions.
+ *
+ * @param Group Pointer to the group.
+ * @param Encoders Array of initialized encoders.
+ * @param EncodersCount Number of encoders.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error or the group runs out of ports.
+ */
+BTN_operate_status ButtonGroupSetEncoders(button_group_t *Group, button_encoder_t *Encoders, uint8_t EncodersCount)
+{
+    if (Group == NULL || Group->Keys == NULL || (Encoders == NULL && EncodersCount != 0U))
+    {
+        return BTN_ERROR;
+    }
+
+    for (uint8_t i = 0; i < EncodersCount; i++)
+    {
+        button_encoder_t *Encoder = &Encoders[i];
+
+        if (Encoder->PortA == NULL || Encoder->PortB == NULL)
+        {
+            return BTN_ERROR;
+        }
+        Encoder->IndexA = ButtonGroupPortIndex(Group, Encoder->PortA);
+        Encoder->IndexB = ButtonGroupPortIndex(Group, Encoder->PortB);
+        if (Encoder->IndexA >= BTN_GROUP_MAX_PORTS || Encoder->IndexB >= BTN_GROUP_MAX_PORTS)
+        {
+            return BTN_ERROR;
+        }
+        Group->PortState[Encoder->IndexA] = ReadPort(Encoder->PortA);
+        Group->PortState[Encoder->IndexB] = ReadPort(Encoder->PortB);
+        Encoder->State = ButtonEncoderLevel(Encoder, Group->PortState);
+        Encoder->Quarter = 0;
+        Encoder->Direction = 0;
+#if BTN_EVENT_QUEUE && (BTN_EVENT_QUEUE_COUNT > 1)
+        Encoder->Key.Queue = Group->Queue;
+#endif
+    }
+    Group->Encoders = Encoders;
+    Group->EncodersCount = EncodersCount;
+    return BTN_OK;
+}
+#endif
+
+#if BTN_CAPTURE
+/**
+ * @brief Prepares a capture ring buffer.
+ *
+ * @param Capture Pointer to the capture.
+ * @param Records Record storage.
+ * @param Capacity Number of records `Records` can hold.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonCaptureInit(button_capture_t *Capture, button_capture_record_t *Records, uint16_t Capacity)
+{
+    if (Capture == NULL || Records == NULL || Capacity == 0U)
+    {
+        return BTN_ERROR;
+    }
+
+    memset(Capture, 0, sizeof(button_capture_t));
+    Capture->Records = Records;
+    Capture->Capacity = Capacity;
+    return BTN_OK;
+}
+
+/**
+ * @brief Attaches a capture to a group, or detaches it.
+ *
+ * @param Group Pointer to the group.
+ * @param Capture Pointer to an initialized capture, or NULL to stop capturing.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGroupSetCapture(button_group_t *Group, button_capture_t *Capture)
+{
+    if (Group == NULL || (Capture != NULL && Capture->Records == NULL))
+    {
+        return BTN_ERROR;
+    }
+
+    Group->Capture = Capture;
+    return BTN_OK;
+}
+
+/**
+ * @brief Stops recording, keeping the captured trace.
+ *
+ * @param Capture Pointer to the capture.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonCaptureFreeze(button_capture_t *Capture)
+{
+    if (Capture == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    Capture->Frozen = 1;
+    return BTN_OK;
+}
+
+/**
+ * @brief Exports a frozen capture as a replayable trace.
+ *
+ * One record per port with its base level comes first, then the ring from the
+ * oldest to the newest record.
+ *
+ * @param Capture Pointer to a frozen capture.
+ * @param Records Output: trace records.
+ * @param Capacity Number of records `Records` can hold.
+ * @param Count Output: number of exported records.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if the capture is not frozen or `Records` is too small.
+ */
+BTN_operate_status ButtonCaptureExport(const button_capture_t *Capture, button_capture_record_t *Records,
+                                       uint16_t Capacity, uint16_t *Count)
+{
+    uint16_t Index;
+    uint16_t Out = 0;
+
+    if (Capture == NULL || Records == NULL || Count == NULL || Capture->Frozen == 0U ||
+        (uint32_t)Capture->PortsCount + Capture->Count > Capacity)
+    {
+        return BTN_ERROR;
+    }
+
+    for (uint8_t Port = 0; Port < Capture->PortsCount; Port++)
+    {
+        Records[Out].Delta = 0;
+        Records[Out].Port = Port;
+        Records[Out].Value = Capture->Base[Port];
+        Out++;
+    }
+    Index = (Capture->Head >= Capture->Count) ? (uint16_t)(Capture->Head - Capture->Count)
+                                              : (uint16_t)(Capture->Head + Capture->Capacity - Capture->Count);
+    for (uint16_t i = 0; i < Capture->Count; i++)
+    {
+        Records[Out] = Capture->Records[Index];
+        Out++;
+        Index = (uint16_t)(Index + 1U);
+        if (Index == Capture->Capacity)
+        {
+            Index = 0;
+        }
+    }
+    *Count = Out;
+    return BTN_OK;
+}
+#endif
+#endif
+
+#if BTN_EVENT_QUEUE
+/**
+ * @brief Runs the callbacks of all queued button events.
+ *
+ * Drains the event queues one after another, each in order, and calls the
+ * callback registered for each event (or the event handler in
+ * `BTN_EVENT_HANDLER` mode). Must be called from a single context (typically
+ * the main loop), while `ButtonTask` / `ButtonGroupTask` may run in an
+ * interrupt or on other cores.
+ *
+ * @return Status of the dispatch:
+ *         - `BTN_OK` if all events were delivered.
+ *         - `BTN_ERROR` if events were dropped because the queue was full
+ *           since the previous call.
+ */
+BTN_operate_status ButtonDispatchEvents(void)
+{
+    BTN_operate_status Status = BTN_OK;
+
+    for (uint8_t Queue = 0; Queue < BTN_EVENT_QUEUE_COUNT; Queue++)
+    {
+        uint8_t Tail = BTN_EventTail[Queue];
+
+        while (Tail != BTN_EventHead[Queue])
+        {
+            button_event_record_t Record;
+
+            BTN_MEMORY_BARRIER();
+            Record = BTN_EventBuffer[Queue][Tail & (BTN_EVENT_QUEUE_SIZE - 1)];
+            BTN_MEMORY_BARRIER();
+            BTN_EventTail[Queue] = ++Tail;
+
+            ButtonEventInvoke(Record.Key, (button_event_t)Record.Event, &Record.Info);
+        }
+
+        if (BTN_EventDropped[Queue])
+        {
+            BTN_EventDropped[Queue] = 0;
+            Status = BTN_ERROR;
+        }
+    }
+    return Status;
+}
+
+#if BTN_EVENT_QUEUE_COUNT > 1
+/**
+ * @brief Selects the event queue receiving the events of a button.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Queue Index of the queue (below `BTN_EVENT_QUEUE_COUNT`).
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonSetEventQueue(button_t *Key, uint8_t Queue)
+{
+    if (Key == NULL || Queue >= BTN_EVENT_QUEUE_COUNT)
+    {
+        return BTN_ERROR;
+    }
+
+    Key->Queue = Queue;
+    return BTN_OK;
+}
+
+#if BTN_GROUP
+/**
+ * @brief Pins a group to an event queue.
+ *
+ * Routes the events of every button of the group, and of its chords, into
+ * `Queue`. Chords set later with `ButtonGroupSetChords()` use it as well.
+ *
+ * @param Group Pointer to the group.
+ * @param Queue Index of the queue (below `BTN_EVENT_QUEUE_COUNT`).
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGroupSetEventQueue(button_group_t *Group, uint8_t Queue)
+{
+    if (Group == NULL || Group->Keys == NULL || Queue >= BTN_EVENT_QUEUE_COUNT)
+    {
+        return BTN_ERROR;
+    }
+
+    Group->Queue = Queue;
+    for (uint16_t i = 0; i < Group->KeysCount; i++)
+    {
+        Group->Keys[i].Queue = Queue;
+    }
+#if BTN_CHORD
+    for (uint8_t i = 0; i < Group->ChordsCount; i++)
+    {
+        Group->Chords[i].Key.Queue = Queue;
+    }
+#endif
+#if BTN_ENCODER
+    for (uint8_t i = 0; i < Group->EncodersCount; i++)
+    {
+        Group->Encoders[i].Key.Queue = Queue;
+    }
+#endif
+    return BTN_OK;
+}
+#endif
+#endif
+#endif
+
+/* ========================== Time Settings Functions =========================
+ */
+/**
+ * @brief Sets the debounce time for the button.
+ *
+ * This function configures the debounce time, which determines the minimum time
+ * between button presses that are considered separate events. This helps in
+ * avoiding false triggering due to contact bounce.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Miliseconds Debounce time in milliseconds.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonSetDebounceTime(button_t *Key, BTN_TIME_t Miliseconds)
+{
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL)
+    {
+        return BTN_ERROR;
+    }
+    Config->TimerDebounce = Miliseconds;
+    return ButtonConfigCommit(Key, Config);
+}
+
+#if BTN_SAMPLE_DEBOUNCE
+/**
+ * @brief Selects sample count debouncing for the button.
  *
- * @note This function should be called in the main loop or system task to
- * ensure the button state machine is regularly processed. The specific state
- * handling functions are invoked based on the current state of the button.
+ * With a non-zero `Samples` a press (and, with `BTN_DOUBLE_DEBOUNCING`, a
+ * release) is accepted only after `Samples` consecutive task passes sampled
+ * the new level, and a debounce falls back once as many consecutive passes
+ * sampled the old one. The time based debounce is used again once `Samples` is 0.
  *
- * @return Status of the button operation:
+ * @param Key Pointer to the button structure.
+ * @param Samples Number of identical samples (1 to `BTN_SAMPLE_DEBOUNCE_MAX`),
+ * or 0 for time based debouncing.
+ * @return Status of the operation:
  *         - `BTN_OK` if the operation was successful.
  *         - `BTN_ERROR` if there was an error during the operation.
  */
-
-BTN_operate_status ButtonTask(button_t *Key)
+BTN_operate_status ButtonSetDebounceSamples(button_t *Key, uint8_t Samples)
 {
-    if (Key == NULL)
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL || Samples > BTN_SAMPLE_DEBOUNCE_MAX)
     {
         return BTN_ERROR;
     }
 
-    switch (Key->State)
+    Config->DebounceSamples = Samples;
+    if (BTN_CFG_IN_PLACE(Key, Config))
     {
-    case IDLE:
-        ButtonIdleRoutine(Key);
-        break;
-
-    case DEBOUNCE:
-        ButtonDebounceRoutine(Key);
-        break;
-
-    case PRESSED:
-        ButtonPressedRoutine(Key);
-        break;
-
-    case REPEAT:
-        ButtonRepeatRoutine(Key);
-        break;
-
-#if BTN_DOUBLE_DEBOUNCING
-    case DEBOUNCE_RELEASE:
-        ButtonDebounceReleaseRoutine(Key);
-        break;
-#endif
-
-    case RELEASE:
-        ButtonReleaseRoutine(Key);
-        break;
-
-#if BTN_RELEASE_AFTER_REPEAT
-    case RELEASE_AFTER_REPEAT:
-        ButtonReleaseAfterRepeatRoutine(Key);
-        break;
+        Key->SampleRun = 0;
+#if BTN_ADAPTIVE_DEBOUNCE
+        ButtonAdaptReset(Key);
 #endif
     }
-    return BTN_OK;
+    return ButtonConfigCommit(Key, Config);
 }
+#endif
 
-/* ========================== Time Settings Functions =========================
- */
+#if BTN_LEADING_EDGE
 /**
- * @brief Sets the debounce time for the button.
+ * @brief Enables or disables leading edge press detection for the button.
  *
- * This function configures the debounce time, which determines the minimum time
- * between button presses that are considered separate events. This helps in
- * avoiding false triggering due to contact bounce.
+ * In leading edge mode the first active sample in `IDLE` fires the press at
+ * once. For `TimerDebounce` after the accepted press, and again after the
+ * accepted release, all input edges are ignored. The release itself is still
+ * debounced as configured.
  *
  * @param Key Pointer to the button structure.
- * @param Miliseconds Debounce time in milliseconds.
+ * @param Enable 1 to fire presses on the leading edge, 0 to debounce them.
  * @return Status of the operation:
  *         - `BTN_OK` if the operation was successful.
  *         - `BTN_ERROR` if there was an error during the operation.
  */
-BTN_operate_status ButtonSetDebounceTime(button_t *Key, BTN_TIME_t Miliseconds)
+BTN_operate_status ButtonSetLeadingEdge(button_t *Key, uint8_t Enable)
 {
-    if (Key == NULL)
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL)
     {
         return BTN_ERROR;
     }
-    Key->TimerDebounce = Miliseconds;
-    return BTN_OK;
+
+    Config->LeadingEdge = (Enable != 0U);
+    if (BTN_CFG_IN_PLACE(Key, Config))
+    {
+        Key->Lockout = 0;
+    }
+    return ButtonConfigCommit(Key, Config);
 }
+#endif
 
 #if BTN_DOUBLE_DEBOUNCING
 /**
@@ -878,12 +5396,77 @@ BTN_operate_status ButtonSetDebounceTime(button_t *Key, BTN_TIME_t Miliseconds)
  */
 BTN_operate_status ButtonSetReleaseDebounceTime(button_t *Key, BTN_TIME_t Miliseconds)
 {
-    if (Key == NULL)
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    Config->TimerSecondDebounce = Miliseconds;
+    return ButtonConfigCommit(Key, Config);
+}
+#endif
+
+#if BTN_ADAPTIVE_DEBOUNCE
+/**
+ * @brief Enables adaptive debouncing of a button within the given bounds.
+ *
+ * Stores the bounds in the button's configuration and restarts learning, so
+ * the debounce windows begin at `MaxTime` and shrink towards the measured
+ * settling times.
+ *
+ * @param Key Pointer to the button structure.
+ * @param MinTime Shortest debounce window.
+ * @param MaxTime Longest debounce window, or 0 to disable adaptation.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonSetAdaptiveDebounce(button_t *Key, BTN_TIME_t MinTime, BTN_TIME_t MaxTime)
+{
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL || (MaxTime != 0U && MinTime > MaxTime))
+    {
+        return BTN_ERROR;
+    }
+
+    Config->DebounceMin = MinTime;
+    Config->DebounceMax = MaxTime;
+    if (BTN_CFG_IN_PLACE(Key, Config))
+    {
+        ButtonAdaptReset(Key);
+    }
+    return ButtonConfigCommit(Key, Config);
+}
+
+/**
+ * @brief Reports the debounce windows currently used by a button.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Press Output: press debounce window.
+ * @param Release Output: release debounce window (may be NULL).
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGetDebounceTime(const button_t *Key, BTN_TIME_t *Press, BTN_TIME_t *Release)
+{
+    if (Key == NULL || !BTN_CFG_VALID(Key) || Press == NULL)
     {
         return BTN_ERROR;
     }
 
-    Key->TimerSecondDebounce = Miliseconds;
+    *Press = ButtonDebounceTime(Key);
+    if (Release != NULL)
+    {
+#if BTN_DOUBLE_DEBOUNCING
+        *Release = ButtonReleaseDebounceTime(Key);
+#else
+        *Release = 0;
+#endif
+    }
     return BTN_OK;
 }
 #endif
@@ -903,13 +5486,15 @@ BTN_operate_status ButtonSetReleaseDebounceTime(button_t *Key, BTN_TIME_t Milise
  */
 BTN_operate_status ButtonSetLongPressedTime(button_t *Key, BTN_TIME_t Miliseconds)
 {
-    if (Key == NULL)
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL)
     {
         return BTN_ERROR;
     }
 
-    Key->TimerLongPressed = Miliseconds;
-    return BTN_OK;
+    Config->TimerLongPressed = Miliseconds;
+    return ButtonConfigCommit(Key, Config);
 }
 
 /**
@@ -926,14 +5511,85 @@ BTN_operate_status ButtonSetLongPressedTime(button_t *Key, BTN_TIME_t Milisecond
  */
 BTN_operate_status ButtonSetRepeatTime(button_t *Key, BTN_TIME_t Miliseconds)
 {
-    if (Key == NULL)
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    Config->TimerRepeat = Miliseconds;
+    return ButtonConfigCommit(Key, Config);
+}
+
+#if BTN_REPEAT_PROFILE
+/**
+ * @brief Sets the repeat acceleration profile of the button.
+ *
+ * The profile is a table of stages sorted by `After`. Stage 0 applies from the
+ * first repeat; every next stage takes over once the button has repeated
+ * `After` times since the long press. The table is referenced, not copied, so
+ * one `const` table can be shared by many configurations.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Profile Pointer to the stage table, or NULL to repeat every
+ * `TimerRepeat`.
+ * @param Count Number of stages in `Profile`.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation (including
+ *           an empty, unsorted or zero interval table).
+ */
+BTN_operate_status ButtonSetRepeatProfile(button_t *Key, const button_repeat_stage_t *Profile, uint8_t Count)
+{
+    button_config_t *Config = ButtonConfigEdit(Key);
+    uint8_t i;
+
+    if (Config == NULL || (Profile != NULL && Count == 0U))
+    {
+        return BTN_ERROR;
+    }
+    for (i = 0; Profile != NULL && i < Count; i++)
+    {
+        if (Profile[i].Interval == 0U || (i > 0U && Profile[i].After < Profile[i - 1U].After))
+        {
+            return BTN_ERROR;
+        }
+    }
+
+    Config->RepeatProfile = Profile;
+    Config->RepeatProfileCount = (Profile != NULL) ? Count : 0U;
+    if (BTN_CFG_IN_PLACE(Key, Config))
+    {
+        Key->RepeatStage = 0;
+    }
+    return ButtonConfigCommit(Key, Config);
+}
+
+/**
+ * @brief Reports the step multiplier of the button's current repeat.
+ *
+ * Intended for `ButtonRepeat` callbacks, which do not receive the event info
+ * record of handler mode.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Step Output: step of the current repeat profile stage (1 without a
+ * profile).
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGetRepeatStep(const button_t *Key, uint16_t *Step)
+{
+    if (Key == NULL || !BTN_CFG_VALID(Key) || Step == NULL)
     {
         return BTN_ERROR;
     }
 
-    Key->TimerRepeat = Miliseconds;
+    *Step = ButtonRepeatStep(Key);
     return BTN_OK;
 }
+#endif
 
 #if BTN_MULTIPLE_CLICK
 /**
@@ -951,18 +5607,106 @@ BTN_operate_status ButtonSetRepeatTime(button_t *Key, BTN_TIME_t Miliseconds)
  */
 BTN_operate_status ButtonSetMultipleClickTime(button_t *Key, BTN_TIME_t Miliseconds)
 {
-    if (Key == NULL)
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL)
     {
         return BTN_ERROR;
     }
 
-    Key->TimerBetweenClick = Miliseconds;
-    return BTN_OK;
+    Config->TimerBetweenClick = Miliseconds;
+    return ButtonConfigCommit(Key, Config);
 }
 #endif
 
+/**
+ * @brief Reports the info record of the event being delivered.
+ *
+ * Valid only while a callback or the event handler runs; the record is the
+ * one built by the state machine when the event occurred.
+ *
+ * @param Info Output: info record of the current event.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if `Info` is NULL or no event is being delivered.
+ */
+BTN_operate_status ButtonGetEventInfo(button_event_info_t *Info)
+{
+    const button_event_info_t *Current = BTN_EventInfo;
+
+    if (Info == NULL || Current == NULL)
+    {
+        return BTN_ERROR;
+    }
+    *Info = *Current;
+    return BTN_OK;
+}
+
 /* ========================== Callback Registration Functions
  * ========================= */
+#if BTN_EVENT_HANDLER
+/**
+ * @brief Registers the event handler of a button.
+ *
+ * In handler mode every event of the button is delivered to a single function
+ * instead of per-event callbacks. Only the events selected in `EventMask` are
+ * delivered; the others are discarded without any call.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Handler Pointer to the event handler, or NULL to disable delivery.
+ * @param EventMask Mask of enabled events built with `BTN_EVENT_MASK()` (or
+ * `BTN_EVENT_MASK_ALL`).
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonRegisterEventHandler(button_t *Key, button_event_handler_t Handler, uint16_t EventMask)
+{
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    Config->Handler = Handler;
+    Config->EventMask = EventMask;
+    return ButtonConfigCommit(Key, Config);
+}
+
+#if BTN_GROUP
+/**
+ * @brief Registers one event handler for all buttons of a group.
+ *
+ * Equivalent to calling `ButtonRegisterEventHandler()` for every button of the
+ * group, so that all of them are routed into one application function.
+ *
+ * @param Group Pointer to the group.
+ * @param Handler Pointer to the event handler, or NULL to disable delivery.
+ * @param EventMask Mask of enabled events built with `BTN_EVENT_MASK()`.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGroupRegisterEventHandler(button_group_t *Group, button_event_handler_t Handler,
+                                                   uint16_t EventMask)
+{
+    if (Group == NULL || Group->Keys == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    for (uint16_t i = 0; i < Group->KeysCount; i++)
+    {
+        if (ButtonRegisterEventHandler(&Group->Keys[i], Handler, EventMask) != BTN_OK)
+        {
+            return BTN_ERROR;
+        }
+    }
+    return BTN_OK;
+}
+#endif
+#else
 /**
  * @brief Registers a callback function for the button press event.
  *
@@ -978,13 +5722,15 @@ BTN_operate_status ButtonSetMultipleClickTime(button_t *Key, BTN_TIME_t Miliseco
  */
 BTN_operate_status ButtonRegisterPressCallback(button_t *Key, void *Callback)
 {
-    if (Key == NULL)
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL)
     {
         return BTN_ERROR;
     }
 
-    Key->ButtonPressed = Callback;
-    return BTN_OK;
+    Config->ButtonPressed = Callback;
+    return ButtonConfigCommit(Key, Config);
 }
 
 /**
@@ -1002,12 +5748,14 @@ BTN_operate_status ButtonRegisterPressCallback(button_t *Key, void *Callback)
  */
 BTN_operate_status ButtonRegisterLongPressedCallback(button_t *Key, void *Callback)
 {
-    if (Key == NULL)
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL)
     {
         return BTN_ERROR;
     }
-    Key->ButtonLongPressed = Callback;
-    return BTN_OK;
+    Config->ButtonLongPressed = Callback;
+    return ButtonConfigCommit(Key, Config);
 }
 
 /**
@@ -1026,13 +5774,15 @@ BTN_operate_status ButtonRegisterLongPressedCallback(button_t *Key, void *Callba
  */
 BTN_operate_status ButtonRegisterRepeatCallback(button_t *Key, void *Callback)
 {
-    if (Key == NULL)
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL)
     {
         return BTN_ERROR;
     }
 
-    Key->ButtonRepeat = Callback;
-    return BTN_OK;
+    Config->ButtonRepeat = Callback;
+    return ButtonConfigCommit(Key, Config);
 }
 
 /**
@@ -1050,13 +5800,15 @@ BTN_operate_status ButtonRegisterRepeatCallback(button_t *Key, void *Callback)
  */
 BTN_operate_status ButtonRegisterReleaseCallback(button_t *Key, void *Callback)
 {
-    if (Key == NULL)
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL)
     {
         return BTN_ERROR;
     }
 
-    Key->ButtonRelease = Callback;
-    return BTN_OK;
+    Config->ButtonRelease = Callback;
+    return ButtonConfigCommit(Key, Config);
 }
 
 #if BTN_RELEASE_AFTER_REPEAT
@@ -1076,13 +5828,15 @@ BTN_operate_status ButtonRegisterReleaseCallback(button_t *Key, void *Callback)
  */
 BTN_operate_status ButtonRegisterReleaseAfterRepeatCallback(button_t *Key, void *Callback)
 {
-    if (Key == NULL)
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL)
     {
         return BTN_ERROR;
     }
 
-    Key->ButtonReleaseAfterRepeat = Callback;
-    return BTN_OK;
+    Config->ButtonReleaseAfterRepeat = Callback;
+    return ButtonConfigCommit(Key, Config);
 }
 #endif
 
@@ -1102,13 +5856,15 @@ BTN_operate_status ButtonRegisterReleaseAfterRepeatCallback(button_t *Key, void
  */
 BTN_operate_status ButtonRegisterDoubleClickCallback(button_t *Key, void *Callback)
 {
-    if (Key == NULL)
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL)
     {
         return BTN_ERROR;
     }
 
-    Key->ButtonDoubleClick = Callback;
-    return BTN_OK;
+    Config->ButtonDoubleClick = Callback;
+    return ButtonConfigCommit(Key, Config);
 }
 
 /**
@@ -1126,15 +5882,91 @@ BTN_operate_status ButtonRegisterDoubleClickCallback(button_t *Key, void *Callba
  */
 BTN_operate_status ButtonRegisterTripleClickCallback(button_t *Key, void *Callback)
 {
-    if (Key == NULL)
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL)
     {
         return BTN_ERROR;
     }
 
-    Key->ButtonTripleClick = Callback;
-    return BTN_OK;
+    Config->ButtonTripleClick = Callback;
+    return ButtonConfigCommit(Key, Config);
+}
+
+/**
+ * @brief Registers a callback function for finished click sequences.
+ *
+ * The callback receives the button number and the number of clicks. It is
+ * called in `BTN_MULTIPLE_CLICK_COMBINED_MODE` for buttons with a maximum
+ * click count (`ButtonSetMaxClicks()`) instead of the press, double click and
+ * triple click callbacks.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Callback Pointer to a `void (*)(uint16_t, uint8_t)` function.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonRegisterClickCountCallback(button_t *Key, void *Callback)
+{
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    Config->ButtonClickCount = Callback;
+    return ButtonConfigCommit(Key, Config);
+}
+#endif
+
+#if BTN_ENCODER
+/**
+ * @brief Registers a callback function for clockwise encoder detents.
+ *
+ * @param Key Pointer to the encoder's virtual button.
+ * @param Callback Pointer to the callback function.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonRegisterRotateCwCallback(button_t *Key, void *Callback)
+{
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    Config->ButtonRotateCw = Callback;
+    return ButtonConfigCommit(Key, Config);
+}
+
+/**
+ * @brief Registers a callback function for counter-clockwise encoder detents.
+ *
+ * @param Key Pointer to the encoder's virtual button.
+ * @param Callback Pointer to the callback function.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonRegisterRotateCcwCallback(button_t *Key, void *Callback)
+{
+    button_config_t *Config = ButtonConfigEdit(Key);
+
+    if (Config == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    Config->ButtonRotateCcw = Callback;
+    return ButtonConfigCommit(Key, Config);
 }
 #endif
+#endif
 
 #ifdef HAL_TO_DEFINE
 #define USE_HAL_DRIVER
@@ -21,7 +21,9 @@
  * current time. If set to 0, the state machine uses a pointer to a global time
  * variable.
  */
-#define BT_TICK_FROM_FUNC 0
+#ifndef BTN_TICK_FROM_FUNC
+#define BTN_TICK_FROM_FUNC 0
+#endif
 
 /**
  * @brief Time base configuration for the state machine module.
@@ -30,25 +32,29 @@
  * `BTN_TIME_BASE_TYPE_CUSTOM` as the desired type (e.g. `uint16_t`, `uint64_t`,
  * etc.) and define the appropriate `_IS_*` macro (e.g.
  * `BTN_TIME_BASE_TYPE_CUSTOM_IS_UINT16`) to allow the code to determine
- * `BTN_MAX_TIMEOUT`. Only unsigned integer types are supported. variables are
- * recommended for time bases for proper overflow handling.
+ * `BTN_MAX_TIMEOUT`. Only unsigned integer types are supported.
+ *
+ * All timestamps and timings stored in `button_t` / `button_config_t` use this
+ * type, and every elapsed time is computed modulo its width, so a `uint16_t`
+ * time base halves the timing fields and stays correct across tick wraparound
+ * as long as no single timing exceeds `BTN_MAX_TIMEOUT` (about 65 s at 1 ms).
  */
 #ifndef BTN_TIME_BASE_TYPE_CUSTOM
 
 #define BTN_MAX_TIMEOUT UINT32_MAX
-typedef volatile uint32_t BTN_TIME_t;
+typedef uint32_t BTN_TIME_t;
 
 #else
 
 typedef BTN_TIME_BASE_TYPE_CUSTOM BTN_TIME_t;
 
-#if defined(SM_TIME_BASE_TYPE_CUSTOM_IS_UINT8)
+#if defined(BTN_TIME_BASE_TYPE_CUSTOM_IS_UINT8)
 #define BTN_MAX_TIMEOUT UINT8_MAX
-#elif defined(SM_TIME_BASE_TYPE_CUSTOM_IS_UINT16)
+#elif defined(BTN_TIME_BASE_TYPE_CUSTOM_IS_UINT16)
 #define BTN_MAX_TIMEOUT UINT16_MAX
-#elif defined(SM_TIME_BASE_TYPE_CUSTOM_IS_UINT32)
+#elif defined(BTN_TIME_BASE_TYPE_CUSTOM_IS_UINT32)
 #define BTN_MAX_TIMEOUT UINT32_MAX
-#elif defined(SM_TIME_BASE_TYPE_CUSTOM_IS_UINT64)
+#elif defined(BTN_TIME_BASE_TYPE_CUSTOM_IS_UINT64)
 #define BTN_MAX_TIMEOUT UINT64_MAX
 #else
 #error "BTN_MAX_TIMEOUT: Unknown BTN_TIME_BASE_TYPE_CUSTOM or missing _IS_* define"
@@ -56,6 +62,18 @@ typedef BTN_TIME_BASE_TYPE_CUSTOM BTN_TIME_t;
 
 #endif
 
+/**
+ * @brief Type of the tick variable registered with
+ * `BTN_tick_variable_register()`.
+ *
+ * Defaults to `BTN_TIME_t`. With a narrower custom time base it can be defined
+ * as the type of the system tick (e.g. `uint32_t` for the HAL `uwTick`); the
+ * tick is then truncated to `BTN_TIME_t` when it is sampled.
+ */
+#ifndef BTN_TICK_VARIABLE_T
+#define BTN_TICK_VARIABLE_T BTN_TIME_t
+#endif
+
 /**
  * @brief Enum for button states.
  *
@@ -97,220 +115,1576 @@ typedef enum
 } ReverseLogicGpio_t;
 
 /**
- * @brief Enum for multiple click modes.
+ * @brief Enum for multiple click modes.
+ *
+ * This enumeration defines the different modes available for handling multiple
+ * clicks on a button. It allows the configuration of how the button reacts to
+ * multiple consecutive presses.
+ */
+typedef enum
+{
+    BTN_MULTIPLE_CLICK_OFF = 0,      /**< No multiple click handling (disabled). */
+    BTN_MULTIPLE_CLICK_NORMAL_MODE,  /**< Normal mode for multiple click detection.
+                                      */
+    BTN_MULTIPLE_CLICK_COMBINED_MODE /**< Combined mode for handling click cycles.
+                                      */
+} MultipleClickMode_t;
+
+/**
+ * @brief Enum for operation status codes.
+ * This enumeration defines the status codes returned by button library
+ * functions to indicate success or failure of operations.
+ * @note BTN_OK indicates a successful operation, while BTN_ERROR indicates an
+ * error occurred during the operation.
+ */
+typedef enum
+{
+    BTN_OK = 0,   /**< Operation completed successfully. */
+    BTN_ERROR = 1 /**< An error occurred during the operation. */
+} BTN_operate_status;
+
+/**
+ * @brief Enum for button events.
+ *
+ * This enumeration identifies the events produced by the button state machine.
+ * Each event corresponds to one of the user callbacks of `button_t`.
+ */
+typedef enum
+{
+    BTN_EVENT_PRESSED = 0,          /**< Press confirmed (`ButtonPressed`). */
+    BTN_EVENT_LONG_PRESSED,         /**< Long press detected (`ButtonLongPressed`). */
+    BTN_EVENT_REPEAT,               /**< Repeat while held (`ButtonRepeat`). */
+    BTN_EVENT_RELEASE,              /**< Release after a short press (`ButtonRelease`). */
+    BTN_EVENT_RELEASE_AFTER_REPEAT, /**< Release after repeat (`ButtonReleaseAfterRepeat`). */
+    BTN_EVENT_DOUBLE_CLICK,         /**< Double click (`ButtonDoubleClick`). */
+    BTN_EVENT_TRIPLE_CLICK,         /**< Triple click (`ButtonTripleClick`). */
+    BTN_EVENT_NON_USED,             /**< Button not used for `TimerNonUsed` (`ButtonNonUsed`). */
+    BTN_EVENT_CLICK_COUNT,          /**< Finished sequence of `Clicks` clicks (`ButtonClickCount`). */
+    BTN_EVENT_ROTATE_CW,            /**< Encoder turned one detent clockwise (`ButtonRotateCw`). */
+    BTN_EVENT_ROTATE_CCW            /**< Encoder turned one detent counter-clockwise (`ButtonRotateCcw`). */
+} button_event_t;
+
+/**
+ * @brief Builds the event mask bit of a `button_event_t`.
+ */
+#define BTN_EVENT_MASK(Event) ((uint16_t)(1U << (Event)))
+
+/**
+ * @brief Event mask enabling all events.
+ */
+#define BTN_EVENT_MASK_ALL ((uint16_t)0xFFFFU)
+
+/**
+ * @brief Additional information delivered with an event.
+ *
+ * Passed to the event handler in handler mode; callbacks can read it with
+ * `ButtonGetEventInfo()`. All values are taken by the state machine when the
+ * event occurs, so they are exact even if the event is dispatched later.
+ */
+typedef struct
+{
+    BTN_TIME_t Tick;     /**< Tick at which the event occurred. */
+    uint8_t Clicks;      /**< Clicks of a click event: 2 or 3 for a double or triple click, the
+                            count of a `BTN_EVENT_CLICK_COUNT` event, 0 otherwise. */
+    uint16_t Step;       /**< Step multiplier of a `BTN_EVENT_REPEAT` event (1 without a
+                            repeat profile) or of an encoder rotate event. */
+    BTN_TIME_t Duration; /**< Time since the accepted press for long press and repeat events,
+                            press duration for release events, 0 otherwise
+                            (`BTN_EVENT_PRESS_INFO`). */
+    uint16_t Repeats;    /**< Repeats of the current press, including this one, for repeat and
+                            release events, 0 otherwise (`BTN_EVENT_PRESS_INFO`). */
+} button_event_info_t;
+
+/**
+ * @brief Single event handler receiving all events of a button
+ * (`BTN_EVENT_HANDLER` mode).
+ *
+ * @param Number Identifier of the button (`NumberBtn`).
+ * @param Event The event that occurred.
+ * @param Info Additional information about the event.
+ */
+typedef void (*button_event_handler_t)(uint16_t Number, button_event_t Event, const button_event_info_t *Info);
+
+#if BTN_REPEAT_PROFILE
+/**
+ * @brief One stage of a repeat acceleration profile.
+ *
+ * A profile is a `const` array of stages sorted by `After`, e.g.
+ * `{ {0, 300, 1}, {10, 100, 1}, {30, 50, 10} }`: 300 ms steps of 1 at first,
+ * 100 ms from the 10th repeat and 50 ms steps of 10 from the 30th.
+ */
+typedef struct
+{
+    uint16_t After;      /**< Repeat count (since the long press) from which the stage applies. */
+    BTN_TIME_t Interval; /**< Time between repeats in this stage. */
+    uint16_t Step;       /**< Step multiplier reported with the repeats of this stage. */
+} button_repeat_stage_t;
+#endif
+
+/**
+ * @brief Button configuration shared by one or more buttons.
+ *
+ * This structure holds everything that stays constant after initialization:
+ * the timing thresholds, the reverse logic setting, the multiple click mode and
+ * the event callbacks. With `BTN_SHARED_CONFIG` enabled, it can be defined
+ * `const` (placed in flash) and referenced by many buttons at once.
+ */
+typedef struct
+{
+    BTN_TIME_t TimerDebounce;        /**< Debounce time in milliseconds. */
+    BTN_TIME_t TimerLongPressed;     /**< Time threshold for a long press. */
+    BTN_TIME_t TimerRepeat;          /**< Repeat time threshold for repeated presses. */
+    ReverseLogicGpio_t ReverseLogic; /**< Logic level inversion for the button (if
+                                        applicable). */
+#if BTN_DOUBLE_DEBOUNCING
+    BTN_TIME_t TimerSecondDebounce; /**< Debounce time for the release state in
+                                       milliseconds. */
+#endif
+#if BTN_SAMPLE_DEBOUNCE
+    uint8_t DebounceSamples; /**< Identical samples required to settle (0: time based). */
+#endif
+#if BTN_LEADING_EDGE
+    uint8_t LeadingEdge; /**< Non-zero if presses fire on the leading edge. */
+#endif
+#if BTN_ADAPTIVE_DEBOUNCE
+    BTN_TIME_t DebounceMin; /**< Shortest adaptive debounce window. */
+    BTN_TIME_t DebounceMax; /**< Longest adaptive debounce window (0 disables adaptation). */
+#endif
+#if BTN_MULTIPLE_CLICK
+    MultipleClickMode_t MultipleClickMode; /**< Mode for multiple click handling. */
+    BTN_TIME_t TimerBetweenClick;          /**< Time between multiple clicks. */
+    uint8_t MaxClicks;                     /**< Longest click sequence in combined mode (0: triple,
+                                              no early delivery). */
+#endif
+#if BTN_NON_USED_CALLBACK
+    BTN_TIME_t TimerNonUsed; /**< Inactivity time before the non-used callback (0 disables it). */
+#endif
+#if BTN_REPEAT_PROFILE
+    const button_repeat_stage_t *RepeatProfile; /**< Repeat acceleration stages (NULL: fixed
+                                                   `TimerRepeat`). */
+    uint8_t RepeatProfileCount;                 /**< Number of stages in `RepeatProfile`. */
+#endif
+#if BTN_EVENT_HANDLER
+    button_event_handler_t Handler; /**< Event handler receiving all enabled events. */
+    uint16_t EventMask;             /**< Mask of events delivered to `Handler`. */
+#else
+    void (*ButtonPressed)(uint16_t);     /**< Callback function for button press event. */
+    void (*ButtonLongPressed)(uint16_t); /**< Callback function for long press event. */
+    void (*ButtonRepeat)(uint16_t);      /**< Callback function for repeat press event. */
+    void (*ButtonRelease)(uint16_t);     /**< Callback function for button release event. */
+#if BTN_RELEASE_AFTER_REPEAT
+    void (*ButtonReleaseAfterRepeat)(uint16_t); /**< Callback function for release event after repeat. */
+#endif
+#if BTN_MULTIPLE_CLICK
+    void (*ButtonDoubleClick)(uint16_t); /**< Callback function for double-click event. */
+    void (*ButtonTripleClick)(uint16_t); /**< Callback function for triple-click event. */
+    void (*ButtonClickCount)(uint16_t, uint8_t); /**< Callback function for a finished click
+                                                    sequence (button number, clicks). */
+#endif
+#if BTN_NON_USED_CALLBACK
+    void (*ButtonNonUsed)(uint16_t); /**< Callback function for non-used event. */
+#endif
+#if BTN_ENCODER
+    void (*ButtonRotateCw)(uint16_t);  /**< Callback function for a clockwise encoder detent. */
+    void (*ButtonRotateCcw)(uint16_t); /**< Callback function for a counter-clockwise encoder detent. */
+#endif
+#endif
+} button_config_t;
+
+#if BTN_MULTIPLE_CLICK
+/**
+ * @brief Largest click count accepted by `ButtonSetMaxClicks()` (range of the
+ * 6-bit click counter).
+ */
+#define BTN_MAX_CLICKS 63U
+#endif
+
+#if BTN_SAMPLE_DEBOUNCE
+/**
+ * @brief Largest sample count accepted by `ButtonSetDebounceSamples()`.
+ */
+#define BTN_SAMPLE_DEBOUNCE_MAX 127U
+#endif
+
+/**
+ * @brief Static initializer for a `button_config_t`.
+ *
+ * Allows defining configurations as `const` objects, e.g.
+ * `static const button_config_t Cfg = BTN_CONFIG_INITIALIZER(50, 500, 300, NON_REVERSE);`
+ * The release debounce time defaults to the press debounce time; all other
+ * fields (callbacks, multiple click, non-used) are zero and can be overridden
+ * with designated initializers in a hand-written definition.
+ */
+#if BTN_DOUBLE_DEBOUNCING
+#define BTN_CONFIG_INITIALIZER(Debounce, LongPressed, Repeat, Reverse)                                                 \
+    {                                                                                                                  \
+        .TimerDebounce = (Debounce), .TimerLongPressed = (LongPressed), .TimerRepeat = (Repeat),                       \
+        .ReverseLogic = (Reverse), .TimerSecondDebounce = (Debounce)                                                   \
+    }
+#else
+#define BTN_CONFIG_INITIALIZER(Debounce, LongPressed, Repeat, Reverse)                                                 \
+    {                                                                                                                  \
+        .TimerDebounce = (Debounce), .TimerLongPressed = (LongPressed), .TimerRepeat = (Repeat),                       \
+        .ReverseLogic = (Reverse)                                                                                      \
+    }
+#endif
+
+#if BTN_STATS
+/**
+ * @brief Runtime statistics of a button (`BTN_STATS`).
+ *
+ * Counters saturate instead of wrapping. Times are in ticks, except
+ * `MaxCallbackTime`, which is in units of `BTN_STATS_CLOCK()`.
+ */
+typedef struct
+{
+    uint16_t Bounces;        /**< Input changes seen during `DEBOUNCE` / `DEBOUNCE_RELEASE`. */
+    uint16_t DebounceAborts; /**< Debounces that fell back to `IDLE`. */
+    uint16_t Presses;        /**< Completed presses. */
+    BTN_TIME_t PressMin;     /**< Shortest press, `BTN_MAX_TIMEOUT` if there was none. */
+    BTN_TIME_t PressMax;     /**< Longest press. */
+    uint16_t PressHistogram[BTN_STATS_HISTOGRAM_BINS]; /**< Presses per duration bin (see
+                                                          `BTN_STATS_HISTOGRAM_SHIFT`). */
+    BTN_TIME_t MaxTaskGap;    /**< Longest gap between two passes of the state machine. */
+    uint32_t MaxCallbackTime; /**< Longest time spent in one callback. */
+} button_stats_t;
+#endif
+
+/**
+ * @brief Button structure used for managing the state and behavior of a button.
+ *
+ * This structure holds the runtime state of a button: its current state, GPIO
+ * settings, timestamps and multiple click counters. Timing thresholds and
+ * callbacks live in its `button_config_t`, which is either embedded in the
+ * button or, with `BTN_SHARED_CONFIG` enabled, referenced through a pointer so
+ * that many buttons can share one configuration.
+ *
+ * @note The structure is intended to be used with functions for handling button
+ * debouncing, state transitions, and event callbacks.
+ */
+typedef struct
+{
+    ButtonState_t State;    /**< Current state of the button. */
+    GPIO_TypeDef *GpioPort; /**< GPIO port where the button is connected. */
+    BTN_GPIO_PIN_T GpioPin; /**< GPIO pin where the button is connected. */
+    uint16_t NumberBtn;     /**< Identifier for the button (used in callbacks). */
+    BTN_TIME_t LastTick;    /**< Timestamp of the last button event. */
+#if BTN_SHARED_CONFIG
+#if BTN_ATOMIC_CONFIG
+    const button_config_t *volatile Config;     /**< Configuration of the button, read by the setters. */
+    const button_config_t *volatile ConfigNext; /**< Configuration published for the next pass. */
+    button_config_t *ConfigBuffers;             /**< Two buffers edited by the setters (NULL: in place). */
+#else
+    const button_config_t *Config; /**< Configuration of the button (may be shared). */
+#endif
+#else
+    button_config_t Config; /**< Configuration of the button. */
+#endif
+#if BTN_DOUBLE_DEBOUNCING
+    ButtonState_t StateBeforeRelease;  /**< Previous button state before entering
+                                          the release state. */
+    BTN_TIME_t LastTickSecondDebounce; /**< Timestamp of the last event during the
+                                          release debounce phase. */
+#endif
+#if BTN_MULTIPLE_CLICK
+    uint8_t ClickCounter : 6;              /**< Counter for tracking number of clicks. */
+    uint8_t ClickCounterCycle : 1;         /**< Flag indicating cycle completion. */
+    uint8_t CombinedModeRepeatPressEx : 1; /**< Flag for combined mode repeat
+                                              press. */
+    BTN_TIME_t LastClickTick;              /**< Timestamp of the last click event. */
+    uint8_t ClickResult;                   /**< Clicks of the last finished sequence. */
+#endif
+#if BTN_EVENT_QUEUE && (BTN_EVENT_QUEUE_COUNT > 1)
+    uint8_t Queue; /**< Event queue receiving the button's events. */
+#endif
+#if BTN_GROUP
+    uint8_t PortIndex; /**< Index of the button's port in the owning group's
+                          snapshot. */
+#if BTN_GROUP_ACTIVE_LIST && BTN_GROUP_TIMER_HEAP
+    BTN_TIME_t TimerDue; /**< Tick at which the parked button is run again. */
+    uint16_t TimerSlot;  /**< Position in the group's timer heap + 1 (0: not parked). */
+#endif
+#endif
+#if BTN_EDGE_WAKEUP
+    uint8_t EdgeWakeup;           /**< Non-zero if the button is woken by edges only. */
+    uint8_t Asleep;               /**< Non-zero while the button is skipped by the task. */
+    volatile uint8_t EdgePending; /**< Set from the EXTI handler by `ButtonNotifyEdge`. */
+#endif
+#if BTN_CHORD
+    uint8_t ChordHold : 1;    /**< Member of a suppressing chord: presses are held back. */
+    uint8_t ChordPending : 1; /**< A held back press waits for the chord decision. */
+    uint8_t ChordMuted : 1;   /**< Events are suppressed until the button is idle again. */
+#endif
+#if BTN_ADAPTIVE_DEBOUNCE
+    BTN_TIME_t AdaptPress; /**< Learnt press settling time. */
+#if BTN_DOUBLE_DEBOUNCING
+    BTN_TIME_t AdaptRelease; /**< Learnt release settling time. */
+#endif
+    BTN_TIME_t AdaptEdge;    /**< Tick of the last input change in the current debounce. */
+    uint8_t AdaptActive : 1; /**< Input level after that change. */
+#endif
+#if BTN_SAMPLE_DEBOUNCE
+    uint8_t SampleRun : 7;   /**< Consecutive samples of `SampleLevel`. */
+    uint8_t SampleLevel : 1; /**< Level currently being counted. */
+#endif
+#if BTN_LEADING_EDGE
+    uint8_t Lockout : 1;    /**< Input edges are ignored after a leading edge press or a release. */
+    BTN_TIME_t LockoutTick; /**< Tick at which the lockout started. */
+#endif
+#if BTN_REPEAT_PROFILE || BTN_EVENT_PRESS_INFO
+    uint16_t RepeatCount; /**< Repeats since the long press. */
+#endif
+#if BTN_REPEAT_PROFILE
+    uint8_t RepeatStage; /**< Current stage of the repeat profile. */
+#endif
+#if BTN_EVENT_PRESS_INFO
+    BTN_TIME_t PressTime; /**< Tick of the accepted press; the press duration once the release is
+                             accepted. */
+#endif
+#if BTN_STATS
+    button_stats_t Stats;        /**< Runtime statistics. */
+    BTN_TIME_t StatsLastTick;    /**< Tick of the previous pass of the state machine. */
+    BTN_TIME_t StatsPressTick;   /**< Tick at which the current press was accepted. */
+    uint8_t StatsLastActive : 1; /**< Pressed state sampled in the previous pass. */
+    uint8_t StatsRunning : 1;    /**< `StatsLastTick` holds a valid pass. */
+#endif
+} button_t;
+
+#if BTN_CHORD
+/**
+ * @brief Phases of a chord.
+ */
+typedef enum
+{
+    BTN_CHORD_IDLE = 0, /**< No member is pressed. */
+    BTN_CHORD_OPEN,     /**< Some members are pressed, the window is running. */
+    BTN_CHORD_LATCHED,  /**< All members are pressed: the chord is active. */
+    BTN_CHORD_EXPIRED   /**< The window has passed; waits until all members are released. */
+} ButtonChordPhase_t;
+
+/**
+ * @brief Key combination over the buttons of a group.
+ *
+ * `Mask` holds the member pins per port of the owning group. The chord is
+ * active while all members are pressed, provided the last one was pressed no
+ * later than `Window` after the first one (`Window` 0 accepts any order and
+ * timing, e.g. a SHIFT key held before X). The chord drives its own virtual
+ * button `Key`, so it produces press, long press, repeat and release events
+ * through the configuration and number given to `ButtonChordInit()`.
+ *
+ * With `Suppress` set, the members' own events are suppressed while the chord
+ * is active, and their press events are held back while the chord is still
+ * undecided: they are delivered late if the chord does not form, and dropped
+ * if it does.
+ */
+typedef struct
+{
+    button_t Key;                             /**< Virtual button carrying the chord's events. */
+    BTN_GPIO_PIN_T Mask[BTN_GROUP_MAX_PORTS]; /**< Member pins per group port. */
+    BTN_TIME_t Window;                        /**< Simultaneity window (0: no limit). */
+    BTN_TIME_t FirstTick;                     /**< Tick at which the first member was pressed. */
+    uint8_t Phase;                            /**< Current `ButtonChordPhase_t`. */
+    uint8_t Suppress;                         /**< Non-zero to suppress the members' events. */
+} button_chord_t;
+#endif
+
+#if BTN_ENCODER
+/**
+ * @brief Acceleration stage of a rotary encoder.
+ *
+ * A detent that follows the previous one in the same direction within less
+ * than `Interval` ticks is reported with the multiplier `Step`.
+ */
+typedef struct
+{
+    BTN_TIME_t Interval; /**< Detent interval below which the stage applies. */
+    uint16_t Step;       /**< Step multiplier of the stage. */
+} button_encoder_accel_t;
+
+/**
+ * @brief Quadrature rotary encoder decoded by a button group.
+ *
+ * The two-bit Gray code of pins A and B is decoded with a 16-entry transition
+ * table, so contact bounce cancels out on its own. Every `StepsPerDetent`
+ * accumulated transitions make one detent, delivered through the virtual
+ * button `Key` as a rotate event with the step multiplier of the matching
+ * acceleration stage (1 without stages or after a direction change). `Key`
+ * must stay the first member.
+ */
+typedef struct
+{
+    button_t Key;                        /**< Virtual button carrying the encoder's events. */
+    BTN_GPIO_PORT_T *PortA;              /**< GPIO port of pin A. */
+    BTN_GPIO_PORT_T *PortB;              /**< GPIO port of pin B. */
+    BTN_GPIO_PIN_T PinA;                 /**< Mask of pin A. */
+    BTN_GPIO_PIN_T PinB;                 /**< Mask of pin B. */
+    uint8_t IndexA;                      /**< Index of `PortA` in the group's `Ports`. */
+    uint8_t IndexB;                      /**< Index of `PortB` in the group's `Ports`. */
+    uint8_t State;                       /**< Last two-bit A/B level. */
+    uint8_t StepsPerDetent;              /**< Transitions per detent (1, 2 or 4). */
+    int8_t Quarter;                      /**< Transitions accumulated since the last detent. */
+    int8_t Direction;                    /**< Direction of the last detent (1, -1, 0: none yet). */
+    uint16_t Step;                       /**< Step multiplier of the last detent. */
+    BTN_TIME_t LastDetentTick;           /**< Tick of the last detent. */
+    const button_encoder_accel_t *Accel; /**< Acceleration stages by decreasing `Interval`, or NULL. */
+    uint8_t AccelCount;                  /**< Number of stages in `Accel`. */
+} button_encoder_t;
+#endif
+
+#if BTN_GROUP
+#if BTN_GROUP_ACTIVE_LIST
+/**
+ * @brief Number of pins of one group port (bits of `BTN_GPIO_PIN_T`).
+ */
+#define BTN_GROUP_PIN_BITS (sizeof(BTN_GPIO_PIN_T) * 8U)
+
+/**
+ * @brief Number of 32-bit words of the busy bitmap of a group.
+ */
+#define BTN_GROUP_BUSY_WORDS ((BTN_GROUP_MAX_KEYS + 31U) / 32U)
+#endif
+
+#if BTN_CAPTURE
+/**
+ * @brief One record of a captured input trace.
+ *
+ * `Delta` ticks after the previous record, the input register of group port
+ * `Port` took the value `Value`. Gaps longer than `UINT16_MAX` ticks are split
+ * by records repeating the current value. The layout is the one of
+ * `button_sim_record_t`, so an exported trace replays as it is.
+ */
+typedef struct
+{
+    uint16_t Delta;       /**< Ticks since the previous record. */
+    uint8_t Port;         /**< Index of the port in the group's `Ports`. */
+    BTN_GPIO_PIN_T Value; /**< New input register value of the port. */
+} button_capture_record_t;
+
+/**
+ * @brief Ring buffer of captured port snapshots.
+ *
+ * Filled by the group it is attached to; once full, the oldest records are
+ * overwritten, and the port levels they carried are kept in `Base` so the
+ * exported trace still starts from the exact levels.
+ */
+typedef struct
+{
+    button_capture_record_t *Records;         /**< Record storage. */
+    uint16_t Capacity;                        /**< Number of records `Records` can hold. */
+    uint16_t Head;                            /**< Index of the next record to write. */
+    uint16_t Count;                           /**< Number of stored records. */
+    uint8_t PortsCount;                       /**< Number of captured ports (0 before the first sample). */
+    volatile uint8_t Frozen;                  /**< Non-zero while recording is stopped. */
+    BTN_TIME_t LastTick;                      /**< Tick of the last record (or of the first sample). */
+    BTN_GPIO_PIN_T Level[BTN_GROUP_MAX_PORTS]; /**< Port levels after the newest record. */
+    BTN_GPIO_PIN_T Base[BTN_GROUP_MAX_PORTS];  /**< Port levels before the oldest stored record. */
+} button_capture_t;
+#endif
+
+/**
+ * @brief Button group structure used for batched processing of many buttons.
+ *
+ * The group keeps a list of the distinct GPIO ports used by its buttons. On
+ * every `ButtonGroupTask()` call each port is read once into `PortState`, and
+ * the state machine of every button is then run on the pin masked out of that
+ * snapshot. With `BTN_GROUP_ACTIVE_LIST` enabled, only busy buttons and buttons
+ * whose pin changed since the previous pass are run; with
+ * `BTN_GROUP_TIMER_HEAP`, buttons waiting for a timer only are parked in a heap
+ * until their deadline.
+ *
+ * @note The buttons must be initialized before `ButtonGroupInit()` is called
+ * and must not be moved to another port afterwards without re-initializing the
+ * group.
+ */
+typedef struct
+{
+    button_t *Keys;                                /**< Array of buttons belonging to the group. */
+    uint16_t KeysCount;                            /**< Number of buttons in `Keys`. */
+    BTN_GPIO_PORT_T *Ports[BTN_GROUP_MAX_PORTS];   /**< Distinct ports used by the buttons. */
+    BTN_GPIO_PIN_T PortState[BTN_GROUP_MAX_PORTS]; /**< Port snapshot taken in the last pass. */
+    uint8_t PortsCount;                            /**< Number of used entries in `Ports`. */
+#if BTN_GROUP_VERTICAL_DEBOUNCE
+    uint8_t VerticalDebounce;                        /**< Non-zero when the vertical counters are used. */
+    BTN_TIME_t SamplePeriod;                         /**< Time between two debounce samples. */
+    BTN_TIME_t LastSampleTick;                       /**< Timestamp of the last debounce sample. */
+    BTN_GPIO_PIN_T ActiveLow[BTN_GROUP_MAX_PORTS];   /**< Pins of active-low buttons per port. */
+    BTN_GPIO_PIN_T Pressed[BTN_GROUP_MAX_PORTS];     /**< Debounced "stable pressed" mask per port. */
+    BTN_GPIO_PIN_T Changed[BTN_GROUP_MAX_PORTS];     /**< Pins accepted as changed in the last sample. */
+    BTN_GPIO_PIN_T CounterLow[BTN_GROUP_MAX_PORTS];  /**< Low bit-plane of the vertical counters. */
+    BTN_GPIO_PIN_T CounterHigh[BTN_GROUP_MAX_PORTS]; /**< High bit-plane of the vertical counters. */
+#endif
+#if BTN_GROUP_ACTIVE_LIST
+    uint32_t Busy[BTN_GROUP_BUSY_WORDS];                      /**< Bitmap of the buttons processed in the next pass. */
+    BTN_GPIO_PIN_T LastInput[BTN_GROUP_MAX_PORTS];            /**< Input of the previous pass per port. */
+    uint16_t PinKey[BTN_GROUP_MAX_PORTS][BTN_GROUP_PIN_BITS]; /**< Index + 1 of the button on each pin (0: none). */
+    BTN_GPIO_PIN_T Pins[BTN_GROUP_MAX_PORTS];                 /**< Pins of the group's buttons per port. */
+#if BTN_GROUP_TIMER_HEAP
+    uint16_t Timers[BTN_GROUP_MAX_KEYS]; /**< Min-heap of parked button indexes ordered by `TimerDue`. */
+    uint16_t TimersCount;                /**< Number of parked buttons. */
+    BTN_TIME_t TimerBase;                /**< Tick of the previous pass; every `TimerDue` is after it. */
+#endif
+#endif
+#if BTN_CHORD
+    button_chord_t *Chords;                         /**< Chords evaluated on the group. */
+    uint8_t ChordsCount;                            /**< Number of chords in `Chords`. */
+    BTN_GPIO_PIN_T ChordDown[BTN_GROUP_MAX_PORTS];  /**< Debounced pressed mask of the current pass. */
+    BTN_GPIO_PIN_T ChordHold[BTN_GROUP_MAX_PORTS];  /**< Pins whose presses are held back. */
+    BTN_GPIO_PIN_T ChordMute[BTN_GROUP_MAX_PORTS];  /**< Pins whose events are suppressed. */
+#endif
+#if BTN_ENCODER
+    button_encoder_t *Encoders; /**< Encoders decoded from the group's snapshot. */
+    uint8_t EncodersCount;      /**< Number of encoders in `Encoders`. */
+#endif
+#if BTN_EVENT_QUEUE && (BTN_EVENT_QUEUE_COUNT > 1)
+    uint8_t Queue; /**< Event queue of the group's buttons and chords. */
+#endif
+#if BTN_ATOMIC_CONFIG
+    uint16_t ConfigSerial; /**< Publish counter seen in the last pass. */
+#endif
+#if BTN_CAPTURE
+    button_capture_t *Capture; /**< Trace capture of the group's input, or NULL. */
+#endif
+#if BTN_GROUP_SUSPEND
+    volatile uint8_t Suspended; /**< Non-zero while the group is suspended. */
+#endif
+} button_group_t;
+#endif
+
+#if BTN_PIN_TABLE
+/**
+ * @brief Compile-time description of the GPIO pin of a button.
+ *
+ * `Xor` holds the active level folded into a mask: all ones for an active-low
+ * (`NON_REVERSE`) pin and 0 for an active-high (`REVERSE`) one, so the button
+ * is pressed when `(IDR ^ Xor) & Pin` is non-zero. Entries are meant to be
+ * built with `BTN_PIN()` into a `const` table placed in flash.
+ */
+typedef struct
+{
+    BTN_GPIO_PORT_T *Port; /**< GPIO port where the button is connected. */
+    BTN_GPIO_PIN_T Pin;    /**< GPIO pin mask of the button. */
+    BTN_GPIO_PIN_T Xor;    /**< Active level mask (see above). */
+} button_pin_t;
+
+/**
+ * @brief Active level mask of a `ReverseLogicGpio_t` setting.
+ */
+#define BTN_PIN_XOR(Logic) ((Logic) == REVERSE ? (BTN_GPIO_PIN_T)0U : (BTN_GPIO_PIN_T)~(BTN_GPIO_PIN_T)0U)
+
+/**
+ * @brief Static initializer of a `button_pin_t` entry.
+ */
+#define BTN_PIN(Port, Pin, Logic) {(Port), (BTN_GPIO_PIN_T)(Pin), BTN_PIN_XOR(Logic)}
+
+/**
+ * @brief Reads the logical pressed state of a pin described by constants.
+ *
+ * With constant arguments this compiles to one load of the input register, an
+ * XOR and an AND. The input register is read directly in HAL builds as well.
+ */
+#define BTN_PIN_IS_ACTIVE(Port, Pin, Xor) ((((BTN_GPIO_PIN_T)(Port)->IDR ^ (Xor)) & (Pin)) != 0U)
+
+/**
+ * @brief X-macro helper emitting the `button_pin_t` entry of a list item.
+ *
+ * A button list is defined as
+ * `#define PANEL(X) X(KEY_OK, GPIOA, GPIO_PIN_0, NON_REVERSE) X(...)`; then
+ * `enum { PANEL(BTN_PIN_X_INDEX) PANEL_COUNT };` numbers the buttons and
+ * `static const button_pin_t PanelPins[] = { PANEL(BTN_PIN_X_ENTRY) };` builds
+ * the table in the same order.
+ */
+#define BTN_PIN_X_ENTRY(Name, Port, Pin, Logic) BTN_PIN(Port, Pin, Logic),
+
+/**
+ * @brief X-macro helper emitting the enumerator of a list item.
+ */
+#define BTN_PIN_X_INDEX(Name, Port, Pin, Logic) Name,
+#endif
+
+#if BTN_STATIC_TABLE
+/**
+ * @brief Compile-time definition of a button.
+ *
+ * Everything a button needs that does not change at runtime: its pin with the
+ * folded active level, its configuration and its number. A `const` table of
+ * entries lives in flash next to a zero-initialized `button_t` array, and
+ * `ButtonStaticTask()` binds every button to its entry on the first pass.
+ */
+typedef struct
+{
+    button_pin_t Pin;              /**< GPIO pin and active level of the button. */
+    const button_config_t *Config; /**< Configuration of the button. */
+    uint16_t Number;               /**< Button identifier passed to callback functions. */
+} button_static_t;
+
+/**
+ * @brief Compile-time check usable inside constant expressions.
+ *
+ * Evaluates to 0 if `Cond` holds and fails to compile (negative array size)
+ * otherwise; `Cond` must be a constant expression.
+ */
+#define BTN_STATIC_CHECK(Cond) (0U * sizeof(char[(Cond) ? 1 : -1]))
+
+#if BTN_DOUBLE_DEBOUNCING
+#define BTN_CONFIG_STATIC_RELEASE(Debounce) , .TimerSecondDebounce = (BTN_TIME_t)(Debounce)
+#else
+#define BTN_CONFIG_STATIC_RELEASE(Debounce)
+#endif
+
+/**
+ * @brief Designated initializers of the timings of a `button_config_t`.
+ *
+ * Sets the same fields as `ButtonConfigInit()` (the release debounce time
+ * equals `Debounce`) and fails to compile if `Debounce` is not shorter than
+ * `LongPressed`, if `Repeat` is 0 or if a timing does not fit `BTN_TIME_t`.
+ * Further fields may follow, e.g.
+ * `static const button_config_t Cfg = { BTN_CONFIG_STATIC(20, 500, 100), .Handler = OnEvent };`.
+ * The reverse logic comes from the `button_static_t` entries.
+ */
+#define BTN_CONFIG_STATIC(Debounce, LongPressed, Repeat)                                                              \
+    .TimerDebounce = (BTN_TIME_t)((Debounce) + BTN_STATIC_CHECK((Debounce) < (LongPressed))),                         \
+    .TimerLongPressed = (BTN_TIME_t)((LongPressed) + BTN_STATIC_CHECK((LongPressed) <= BTN_MAX_TIMEOUT)),             \
+    .TimerRepeat = (BTN_TIME_t)((Repeat) + BTN_STATIC_CHECK((Repeat) != 0U && (Repeat) <= BTN_MAX_TIMEOUT))           \
+        BTN_CONFIG_STATIC_RELEASE(Debounce)
+
+/**
+ * @brief Static initializer of a `button_static_t` entry.
+ *
+ * Fails to compile for an empty pin mask.
+ */
+#define BTN_STATIC(Port, Pin, Logic, Config, Number)                                                                  \
+    {BTN_PIN(Port, (Pin) + BTN_STATIC_CHECK((Pin) != 0U), Logic), &(Config), (uint16_t)(Number)}
+
+/**
+ * @brief X-macro helper emitting the `button_static_t` entry of a list item.
+ *
+ * A button list is defined as
+ * `#define PANEL(X) X(KEY_OK, GPIOA, GPIO_PIN_0, NON_REVERSE, PanelCfg) X(...)`;
+ * then `enum { PANEL(BTN_STATIC_X_INDEX) PANEL_COUNT };` numbers the buttons,
+ * `static const button_static_t PanelTable[] = { PANEL(BTN_STATIC_X_ENTRY) };`
+ * builds the table in flash and `button_t Panel[PANEL_COUNT];` the runtime
+ * array in `.bss`. Each button's number is its enumerator.
+ */
+#define BTN_STATIC_X_ENTRY(Name, Port, Pin, Logic, Config) BTN_STATIC(Port, Pin, Logic, Config, Name),
+
+/**
+ * @brief X-macro helper emitting the enumerator of a list item.
+ */
+#define BTN_STATIC_X_INDEX(Name, Port, Pin, Logic, Config) Name,
+#endif
+
+/**
+ * @brief Registers the time source for the button library tick mechanism.
+ *
+ * This function is used to provide the button library with a time base for
+ * managing timeouts, delays, and transition timing. Depending on the
+ * configuration (`BTN_TICK_FROM_FUNC`), the user must provide either a function
+ * that returns the current time or a pointer to a variable representing the
+ * current time.
+ *
+ * - If `BTN_TICK_FROM_FUNC` is set to 1, call `BTN_tick_function_register()`
+ * with a function that returns the current tick value.
+ * - If `BTN_TICK_FROM_FUNC` is set to 0, call `BTN_tick_variable_register()`
+ * with a pointer to a variable that is periodically updated with the current
+ * tick value.
+ *
+ * The tick is sampled once per `ButtonTask()` / `ButtonGroupTask()` call.
+ *
+ * @param Function Pointer to the function returning the current time tick (only
+ * if `BTN_TICK_FROM_FUNC` is 1).
+ * @param Variable Pointer to the time tick variable (only if
+ * `BTN_TICK_FROM_FUNC` is 0).
+ * @return BTN_OK if registration was successful; an error code otherwise.
+ */
+#if BTN_TICK_FROM_FUNC
+BTN_operate_status BTN_tick_function_register(BTN_TIME_t (*Function)(void));
+#else
+BTN_operate_status BTN_tick_variable_register(volatile BTN_TICK_VARIABLE_T *Variable);
+#endif
+
+/**
+ * @brief Returns the current tick of the registered time source.
+ *
+ * Useful to sample the tick once and pass it to the `...At()` task functions.
+ *
+ * @return The current tick, or 0 if no time source is registered.
+ */
+BTN_TIME_t ButtonGetTick(void);
+
+/* ========================== Initialization Functions =========================
+ */
+/**
+ * @brief Initializes a button configuration with the provided parameters.
+ *
+ * The release debounce time is set to `TimerDebounce`, multiple click handling
+ * and the non-used timer are disabled and all callbacks are cleared.
+ *
+ * @param Config Pointer to the configuration structure to initialize.
+ * @param TimerDebounce Debounce time in milliseconds to filter button noise.
+ * @param TimerLongPressed Time in milliseconds to detect a long press.
+ * @param TimerRepeat Time in milliseconds for repeated press events.
+ * @param ReverseLogic Indicates whether the GPIO uses reverse logic
+ * (active-low).
+ * @retval Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if there was an error during initialization.
+ */
+BTN_operate_status ButtonConfigInit(button_config_t *Config, BTN_TIME_t TimerDebounce, BTN_TIME_t TimerLongPressed,
+                                    BTN_TIME_t TimerRepeat, ReverseLogicGpio_t ReverseLogic);
+
+/**
+ * @brief Initializes a button structure with an existing configuration.
+ *
+ * With `BTN_SHARED_CONFIG` enabled the button keeps a pointer to `Config`,
+ * which may be `const` (in flash) and shared by any number of buttons. Without
+ * it, `Config` is copied into the button.
+ *
+ * @param Key Pointer to the button structure to initialize.
+ * @param GpioPort GPIO port where the button is connected.
+ * @param GpioPin GPIO pin where the button is connected.
+ * @param Config Pointer to the button configuration.
+ * @param Number Button identifier passed to callback functions.
+ * @retval Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if there was an error during initialization.
+ */
+BTN_operate_status ButtonInitKeyConfig(button_t *Key, GPIO_TypeDef *GpioPort, uint16_t GpioPin,
+                                       const button_config_t *Config, uint16_t Number);
+
+/**
+ * @brief Initializes a button fed by an input source other than a GPIO pin.
+ *
+ * Instead of a GPIO port and pin, the button references an index in its input
+ * source: the bit of a `button_input_t` bitmap (shift register chain, port
+ * expander, ...) or the key of a `button_adc_t` ladder. The button is processed
+ * by that source; `GpioPort` is NULL and `GpioPin` holds the index.
+ *
+ * @param Key Pointer to the button structure to initialize.
+ * @param Bit Index of the button in its input source.
+ * @param Config Pointer to the button configuration.
+ * @param Number Button identifier passed to callback functions.
+ * @retval Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if an error occurs during initialization.
+ */
+BTN_operate_status ButtonInitKeyBit(button_t *Key, uint16_t Bit, const button_config_t *Config, uint16_t Number);
+
+#if !BTN_SHARED_CONFIG
+/**
+ * @brief Initializes a button structure with the provided parameters.
+ * @param Key Pointer to the button structure to initialize.
+ * @param GpioPort GPIO port where the button is connected.
+ * @param GpioPin GPIO pin where the button is connected.
+ * @param TimerDebounce Debounce time in milliseconds to filter button noise.
+ * @param TimerLongPressed Time in milliseconds to detect a long press.
+ * @param TimerRepeat Time in milliseconds for repeated press events.
+ * @param ReverseLogic Indicates whether the GPIO uses reverse logic
+ * (active-low).
+ * @param Number Button identifier passed to callback functions.
+ * @retval Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if there was an error during initialization.
+ */
+BTN_operate_status ButtonInitKey(button_t *Key, GPIO_TypeDef *GpioPort, uint16_t GpioPin, BTN_TIME_t TimerDebounce,
+                                 BTN_TIME_t TimerLongPressed, BTN_TIME_t TimerRepeat, ReverseLogicGpio_t ReverseLogic,
+                                 uint16_t Number); // Initialization for state machine
+#if BTN_DEFAULT_INIT
+/**
+ * @brief Initializes a button structure with default timing values.
+ * @param Key Pointer to the button structure to initialize.
+ * @param GpioPort GPIO port where the button is connected.
+ * @param GpioPin GPIO pin where the button is connected.
+ * @param ReverseLogic Indicates whether the GPIO uses reverse logic
+ * (active-low).
+ * @param Number Button identifier passed to callback functions.
+ *
+ * This function behaves similarly to `ButtonInitKey`, but uses predefined
+ * default values for debounce time, long press time, and repeat time. These
+ * values are defined as macros in the header file.
+ * @retval Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if there was an error during initialization.
+ */
+BTN_operate_status ButtonInitKeyDefault(button_t *Key, GPIO_TypeDef *GpioPort, uint16_t GpioPin,
+                                        ReverseLogicGpio_t ReverseLogic, uint16_t Number);
+#endif
+#endif
+
+/*
+ * Note: the `ButtonSet*` and `ButtonRegister*Callback` functions below modify
+ * the button's configuration. With `BTN_SHARED_CONFIG` enabled this is the
+ * referenced configuration, which then has to live in RAM, and the change
+ * applies to every button sharing it. With `BTN_ATOMIC_CONFIG` enabled, a
+ * button given configuration buffers gets a private copy instead, published
+ * atomically (see `ButtonSetConfigBuffers()`).
+ */
+
+#if BTN_MULTIPLE_CLICK
+/**
+ * @brief Sets the multiple click mode and the timer between clicks for the
+ * button.
+ *
+ * This function configures the button to operate in different multiple click
+ * modes, such as normal or combined, and sets the time between consecutive
+ * clicks.
+ *
+ * @param Key Pointer to the button structure.
+ * @param MultipleClickMode The mode to handle multiple clicks (e.g.,
+ * BTN_MULTIPLE_CLICK_OFF, BTN_MULTIPLE_CLICK_NORMAL_MODE).
+ * @param TimerBetweenClick Time in milliseconds between two clicks that are
+ * considered part of the same multiple click event.
+ * @retval Status of the configuration:
+ *         - `BTN_OK` if the configuration was successful.
+ *         - `BTN_ERROR` if there was an error during configuration.
+ */
+BTN_operate_status ButtonSetMultipleClick(button_t *Key, MultipleClickMode_t MultipleClickMode,
+                                          BTN_TIME_t TimerBetweenClick);
+
+/**
+ * @brief Sets the longest click sequence of a button in combined mode.
+ *
+ * A non-zero `MaxClicks` enables N-click detection in
+ * `BTN_MULTIPLE_CLICK_COMBINED_MODE`. Sequences of up to `MaxClicks` clicks
+ * are delivered as `BTN_EVENT_CLICK_COUNT` if a click count receiver is
+ * registered, or as press / double click / triple click otherwise. A sequence
+ * is delivered immediately once it reaches `MaxClicks` or no receiver exists
+ * for a longer one (e.g. a single click with only `ButtonPressed` registered),
+ * instead of after `TimerBetweenClick`.
+ *
+ * @param Key Pointer to the button structure.
+ * @param MaxClicks Longest click sequence (1 to `BTN_MAX_CLICKS`), or 0 for the
+ * classic behaviour limited to triple clicks.
+ * @retval Status of the configuration:
+ *         - `BTN_OK` if the configuration was successful.
+ *         - `BTN_ERROR` if there was an error during configuration.
+ */
+BTN_operate_status ButtonSetMaxClicks(button_t *Key, uint8_t MaxClicks);
+#endif
+
+#if BTN_NON_USED_CALLBACK
+/**
+ * @brief Configures the non-used (idle) behavior for a button.
+ *
+ * This function sets the duration of inactivity (in milliseconds) required to
+ * trigger the non-used callback for a specific button. It also assigns the
+ * callback function to be called when the button is considered unused.
+ *
+ * @param Key Pointer to the button instance.
+ * @param Miliseconds Time in milliseconds after which the button is considered
+ * non-used. If set to 0, the non-used functionality is disabled for this
+ * button.
+ * @param Callback Pointer to the function to be executed when the button is
+ * unused.
+ * @return BTN_OK if the configuration was successful; an error code otherwise.
+ *
+ * @note This feature is available only if `BTN_NON_USED_CALLBACK` is set to 1.
+ */
+BTN_operate_status ButtonSetNonUsed(button_t *Key, BTN_TIME_t Miliseconds, void *Callback);
+#endif
+
+/* =================================== State machine
+ * ================================== */
+/**
+ * @brief Handles the button state machine and triggers appropriate routines.
+ *
+ * This function manages the button state transitions and calls the
+ * corresponding routine based on the button's current state. It should be
+ * called in the main loop or system task.
+ *
+ * @param Key Pointer to the button structure being processed.
+ *
+ * @retval Status of the button task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonTask(button_t *Key);
+
+/**
+ * @brief Runs the button state machine at an explicitly given tick.
+ *
+ * Same as `ButtonTask()`, but all timing decisions use `Now` instead of a
+ * fresh sample of the registered tick source.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Now Current tick.
+ * @retval Status of the button operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonTaskAt(button_t *Key, BTN_TIME_t Now);
+
+/**
+ * @brief Runs the button state machine on an input sampled by the caller.
+ *
+ * Used by input sources that do not read one GPIO pin per button (keypad
+ * matrix, bulk input backends): the caller provides the logical pressed state
+ * and the button is debounced and processed as by `ButtonTaskAt()`. The
+ * button's reverse logic setting is not applied to `Active`.
+ *
+ * @param Key Pointer to the button structure being processed.
+ * @param Active Logical pressed state of the button (non-zero when pressed).
+ * @param Now Current tick.
+ * @retval Status of the button operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonFeedInput(button_t *Key, uint8_t Active, BTN_TIME_t Now);
+
+#if BTN_PIN_TABLE
+/**
+ * @brief Runs the state machines of buttons described by a pin table.
+ *
+ * Button `i` is read through `Pins[i]` and processed as by `ButtonFeedInput()`.
+ * The buttons should be initialized with `ButtonInitKeyBit()`: their active
+ * level comes from the table, the reverse logic setting of their configuration
+ * is not used.
+ *
+ * @param Keys Array of `Count` buttons.
+ * @param Pins Array of `Count` pin descriptions, usually `const`.
+ * @param Count Number of buttons.
+ * @retval Status of the task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonPinTableTask(button_t *Keys, const button_pin_t *Pins, uint16_t Count);
+
+/**
+ * @brief Runs the state machines of buttons described by a pin table at an
+ * explicitly given tick.
+ *
+ * Same as `ButtonPinTableTask()`, but all timing decisions use `Now`.
+ *
+ * @param Keys Array of `Count` buttons.
+ * @param Pins Array of `Count` pin descriptions, usually `const`.
+ * @param Count Number of buttons.
+ * @param Now Current tick.
+ * @retval Status of the task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonPinTableTaskAt(button_t *Keys, const button_pin_t *Pins, uint16_t Count, BTN_TIME_t Now);
+#endif
+
+#if BTN_STATIC_TABLE
+/**
+ * @brief Runs the state machines of statically defined buttons.
+ *
+ * Button `i` is described by `Table[i]`. `Keys` may be a zero-initialized
+ * array that was never passed to an initialization function: a button is bound
+ * to its entry (port, pin, number and configuration) on its first pass. Until
+ * then the other button functions report `BTN_ERROR` for it.
+ *
+ * @param Keys Array of `Count` buttons.
+ * @param Table Array of `Count` button definitions, usually `const`.
+ * @param Count Number of buttons.
+ * @retval Status of the task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonStaticTask(button_t *Keys, const button_static_t *Table, uint16_t Count);
+
+/**
+ * @brief Runs the state machines of statically defined buttons at an
+ * explicitly given tick.
+ *
+ * Same as `ButtonStaticTask()`, but all timing decisions use `Now`.
+ *
+ * @param Keys Array of `Count` buttons.
+ * @param Table Array of `Count` button definitions, usually `const`.
+ * @param Count Number of buttons.
+ * @param Now Current tick.
+ * @retval Status of the task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonStaticTaskAt(button_t *Keys, const button_static_t *Table, uint16_t Count, BTN_TIME_t Now);
+#endif
+
+/**
+ * @brief Reports the time until the button's next timer-driven state change.
+ *
+ * Call it after `ButtonTask()` to find out how long the system may sleep
+ * before the button needs to be processed again: the debounce expiry, the long
+ * press threshold, the next repeat, the end of the multiple click window or
+ * the non-used timeout. A new press or release is not covered and has to wake
+ * the system through a GPIO edge.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Ticks Output: ticks until the next deadline (0 means the task should
+ * be called again right away), or `BTN_MAX_TIMEOUT` if no timer is pending.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGetNextDeadline(const button_t *Key, BTN_TIME_t *Ticks);
+
+#if BTN_STATS
+/**
+ * @brief Copies the runtime statistics of a button.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Stats Output: copy of the button's statistics.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGetStats(const button_t *Key, button_stats_t *Stats);
+
+/**
+ * @brief Clears the runtime statistics of a button.
+ *
+ * The gap measurement restarts with the next pass of the state machine.
+ *
+ * @param Key Pointer to the button structure.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonResetStats(button_t *Key);
+#endif
+
+#if BTN_EDGE_WAKEUP
+/**
+ * @brief Enables or disables edge wake-up mode for a button.
+ *
+ * In this mode an idle button without pending multiple click or non-used
+ * timers falls asleep and is skipped by `ButtonTask()` / `ButtonGroupTask()`
+ * until an edge is reported with `ButtonNotifyEdge()` or
+ * `ButtonGroupNotifyEdge()`. Polling cost then scales with the number of active
+ * buttons only.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Enable 1 to enable edge wake-up mode, 0 to poll the button always.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonSetEdgeWakeup(button_t *Key, uint8_t Enable);
+
+/**
+ * @brief Reports an input edge on the button's pin (call from the EXTI
+ * handler).
+ *
+ * A sleeping button is moved into `DEBOUNCE` by its next task call.
+ *
+ * @param Key Pointer to the button structure.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonNotifyEdge(button_t *Key);
+#endif
+
+#if BTN_GROUP
+/* ================================ Button group
+ * ================================ */
+/**
+ * @brief Initializes a button group over an array of buttons.
+ *
+ * The function collects the distinct GPIO ports used by the buttons and stores
+ * the port index in every button, so that `ButtonGroupTask()` can read each
+ * port only once per pass.
+ *
+ * @param Group Pointer to the group structure to initialize.
+ * @param Keys Array of already initialized buttons.
+ * @param KeysCount Number of buttons in `Keys`.
+ * @retval Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if a pointer is NULL, the buttons use more than
+ *           `BTN_GROUP_MAX_PORTS` distinct ports, or (with
+ *           `BTN_GROUP_ACTIVE_LIST`) there are more than `BTN_GROUP_MAX_KEYS`
+ *           buttons.
+ */
+BTN_operate_status ButtonGroupInit(button_group_t *Group, button_t *Keys, uint16_t KeysCount);
+
+#if BTN_GROUP_ACTIVE_LIST
+/**
+ * @brief Marks every button of a group busy for the next pass.
+ *
+ * An idle button is only run again when its input changes. Call this after
+ * changing the configuration of buttons of the group at runtime (e.g. enabling
+ * `TimerNonUsed`), so that idle buttons pick up the new timers.
+ *
+ * @param Group Pointer to the group.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGroupRefresh(button_group_t *Group);
+#endif
+
+/**
+ * @brief Handles the state machines of all buttons in a group.
+ *
+ * Every distinct GPIO port of the group is read once, then the state machine of
+ * each button is run on its pin masked out of that snapshot. It is a drop-in
+ * replacement for calling `ButtonTask()` on every button of the group.
+ *
+ * @param Group Pointer to the group being processed.
+ * @retval Status of the group task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonGroupTask(button_group_t *Group);
+
+/**
+ * @brief Processes all buttons of a group at an explicitly given tick.
+ *
+ * Same as `ButtonGroupTask()`, but all timing decisions use `Now` instead of a
+ * fresh sample of the registered tick source.
+ *
+ * @param Group Pointer to the group being processed.
+ * @param Now Current tick.
+ * @retval Status of the group task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonGroupTaskAt(button_group_t *Group, BTN_TIME_t Now);
+
+/**
+ * @brief Processes a block of port snapshots captured by DMA.
+ *
+ * Instead of reading the ports, every sample of the block is run through the
+ * state machines of all buttons as if `ButtonGroupTask()` had read it, at the
+ * tick the sample was taken. The last sample is taken to be at the current
+ * tick. Intended to be called from the half/full transfer interrupt of a
+ * timer-triggered DMA copying each port's input register into a circular
+ * buffer, so that the CPU only wakes once per block.
+ *
+ * @param Group Pointer to the group being processed.
+ * @param PortSamples One sample buffer per group port, in the order of
+ * `Group->Ports` (the order in which the ports first appear in the key array).
+ * @param SamplesCount Number of samples in every buffer.
+ * @param SamplePeriod Ticks between two consecutive samples.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the block was processed successfully.
+ *         - `BTN_ERROR` if there was an error during processing.
+ */
+BTN_operate_status ButtonGroupProcessBlock(button_group_t *Group, const BTN_GPIO_PIN_T *const *PortSamples,
+                                           uint16_t SamplesCount, BTN_TIME_t SamplePeriod);
+
+/**
+ * @brief Processes a block of port snapshots with an explicitly given tick of
+ * the last sample.
+ *
+ * Same as `ButtonGroupProcessBlock()`; sample `k` of the block is timed at
+ * `Now - (SamplesCount - 1 - k) * SamplePeriod`.
+ *
+ * @param Group Pointer to the group being processed.
+ * @param PortSamples One sample buffer per group port, in the order of
+ * `Group->Ports`.
+ * @param SamplesCount Number of samples in every buffer.
+ * @param SamplePeriod Ticks between two consecutive samples.
+ * @param Now Tick of the last sample of the block.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the block was processed successfully.
+ *         - `BTN_ERROR` if there was an error during processing.
+ */
+BTN_operate_status ButtonGroupProcessBlockAt(button_group_t *Group, const BTN_GPIO_PIN_T *const *PortSamples,
+                                             uint16_t SamplesCount, BTN_TIME_t SamplePeriod, BTN_TIME_t Now);
+
+#if BTN_EDGE_WAKEUP
+/**
+ * @brief Reports input edges on a set of pins to the buttons of a group (call
+ * from the EXTI handler).
+ *
+ * @param Group Pointer to the group.
+ * @param Port GPIO port of the edges, or NULL to match the pins on any port.
+ * @param Pins Mask of the pins that saw an edge.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGroupNotifyEdge(button_group_t *Group, BTN_GPIO_PORT_T *Port, BTN_GPIO_PIN_T Pins);
+#endif
+
+/**
+ * @brief Reports the time until the next timer-driven state change of any
+ * button in a group.
+ *
+ * @param Group Pointer to the group.
+ * @param Ticks Output: minimum of the buttons' deadlines (see
+ * `ButtonGetNextDeadline()`), or `BTN_MAX_TIMEOUT` if none is pending.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGroupGetNextDeadline(const button_group_t *Group, BTN_TIME_t *Ticks);
+
+#if BTN_GROUP_SUSPEND
+/**
+ * @brief Suspends a group before a low-power mode.
+ *
+ * Until `ButtonGroupResume()`, group passes (`ButtonGroupTask()`,
+ * `ButtonGroupProcessBlock()`) return without touching the buttons, and
+ * `ButtonGroupGetNextDeadline()` reports no deadline.
+ *
+ * @param Group Pointer to the group.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGroupSuspend(button_group_t *Group);
+
+/**
+ * @brief Resumes a suspended group.
+ *
+ * Every stored timestamp of the group (buttons, chords, encoders, debounce
+ * sampling, capture) is moved forward by `Elapsed`, so the timers continue where they
+ * stood at suspend. If `WakeKey` is given and idle, it enters `DEBOUNCE` at
+ * the current tick (or is simply woken with vertical debouncing), so the press
+ * that ended the sleep is not lost.
+ *
+ * @param Group Pointer to the suspended group.
+ * @param Elapsed Ticks the tick source advanced while the group was suspended
+ * that must not count, e.g. the sleep time added to the tick after a STOP mode
+ * wake-up; 0 if the tick stood still.
+ * @param WakeKey Button of the group that caused the wake-up, or NULL.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGroupResume(button_group_t *Group, BTN_TIME_t Elapsed, button_t *WakeKey);
+#endif
+
+#if BTN_GROUP_VERTICAL_DEBOUNCE
+/**
+ * @brief Enables or disables bit-parallel debouncing for a button group.
+ *
+ * When enabled, `ButtonGroupTask()` feeds every port snapshot into vertical
+ * counters at most once per `SamplePeriod`, and the buttons consume the
+ * resulting debounced pressed mask. A level change is accepted after 4
+ * consecutive samples, so the effective debounce time is 4 x `SamplePeriod`.
+ * The buttons' own debounce timers are bypassed.
+ *
+ * @param Group Pointer to the group structure.
+ * @param Enable 1 to enable the vertical counters, 0 to return to per-button
+ * debouncing.
+ * @param SamplePeriod Time in milliseconds between two samples (0 samples on
+ * every `ButtonGroupTask()` call).
+ * @retval Status of the configuration:
+ *         - `BTN_OK` if the configuration was successful.
+ *         - `BTN_ERROR` if there was an error during configuration.
+ */
+BTN_operate_status ButtonGroupSetVerticalDebounce(button_group_t *Group, uint8_t Enable, BTN_TIME_t SamplePeriod);
+#endif
+
+#if BTN_CHORD
+/**
+ * @brief Initializes a chord over buttons of a group.
+ *
+ * The members must already belong to an initialized group (`ButtonGroupInit()`),
+ * since the chord mask is built from their port index in that group. The
+ * chord's events are delivered through `Config` with the identifier `Number`.
+ *
+ * @param Chord Pointer to the chord structure to initialize.
+ * @param Members Array of pointers to the member buttons.
+ * @param MembersCount Number of members (at least 2).
+ * @param Window Maximum time between the first and the last member press, or 0
+ * for no limit.
+ * @param Suppress Non-zero to suppress the members' own events (see
+ * `button_chord_t`).
+ * @param Config Configuration of the chord's events and timings.
+ * @param Number Identifier of the chord passed to callbacks.
+ * @retval Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if an error occurs during initialization.
+ */
+BTN_operate_status ButtonChordInit(button_chord_t *Chord, button_t *const *Members, uint8_t MembersCount,
+                                   BTN_TIME_t Window, uint8_t Suppress, const button_config_t *Config,
+                                   uint16_t Number);
+
+/**
+ * @brief Attaches an array of chords to a group.
+ *
+ * The chords are evaluated at the end of every `ButtonGroupTask()` pass, after
+ * the buttons of the group. Passing `ChordsCount` 0 detaches them.
+ *
+ * @param Group Pointer to the group.
+ * @param Chords Array of initialized chords.
+ * @param ChordsCount Number of chords.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGroupSetChords(button_group_t *Group, button_chord_t *Chords, uint8_t ChordsCount);
+#endif
+
+#if BTN_ENCODER
+/**
+ * @brief Initializes a quadrature rotary encoder.
+ *
+ * The encoder's events are delivered through `Config` (rotate callbacks or the
+ * event handler) with identifier `Number`. Swap pins A and B to reverse the
+ * direction.
+ *
+ * @param Encoder Pointer to the encoder structure to initialize.
+ * @param PortA GPIO port of pin A.
+ * @param PinA Mask of pin A.
+ * @param PortB GPIO port of pin B.
+ * @param PinB Mask of pin B.
+ * @param StepsPerDetent Gray code transitions per detent: 4 for full-cycle
+ * encoders, 2 for half-cycle and 1 for quarter-cycle ones.
+ * @param Config Configuration of the encoder's events.
+ * @param Number Identifier of the encoder passed to callbacks.
+ * @retval Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if an error occurs during initialization.
+ */
+BTN_operate_status ButtonEncoderInit(button_encoder_t *Encoder, BTN_GPIO_PORT_T *PortA, BTN_GPIO_PIN_T PinA,
+                                     BTN_GPIO_PORT_T *PortB, BTN_GPIO_PIN_T PinB, uint8_t StepsPerDetent,
+                                     const button_config_t *Config, uint16_t Number);
+
+/**
+ * @brief Sets the velocity-based acceleration of an encoder.
+ *
+ * The table is only referenced, so one `const` table can be shared by many
+ * encoders. Stages are ordered by decreasing `Interval`; the last stage whose
+ * `Interval` is above the time since the previous detent gives the step.
+ *
+ * @param Encoder Pointer to the encoder.
+ * @param Stages Acceleration stages, or NULL for a constant step of 1.
+ * @param StagesCount Number of stages.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonEncoderSetAcceleration(button_encoder_t *Encoder, const button_encoder_accel_t *Stages,
+                                                uint8_t StagesCount);
+
+/**
+ * @brief Attaches an array of encoders to a group.
+ *
+ * Ports of the encoders that no button of the group uses are added to the
+ * group's ports, so one read per port still covers all inputs. The current
+ * pin levels become the encoders' starting positions.
+ *
+ * @param Group Pointer to the group.
+ * @param Encoders Array of initialized encoders.
+ * @param EncodersCount Number of encoders.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error or the group runs out of ports.
+ */
+BTN_operate_status ButtonGroupSetEncoders(button_group_t *Group, button_encoder_t *Encoders, uint8_t EncodersCount);
+#endif
+
+#if BTN_CAPTURE
+/**
+ * @brief Prepares a capture ring buffer.
  *
- * This enumeration defines the different modes available for handling multiple
- * clicks on a button. It allows the configuration of how the button reacts to
- * multiple consecutive presses.
+ * The capture starts recording (unfrozen) with the first snapshot of the group
+ * it is attached to; that snapshot gives the initial port levels. Ports the
+ * group gains later (`ButtonGroupSetEncoders()`) are added with the levels of
+ * the first snapshot that contains them.
+ *
+ * @param Capture Pointer to the capture.
+ * @param Records Record storage.
+ * @param Capacity Number of records `Records` can hold.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
  */
-typedef enum
-{
-    BTN_MULTIPLE_CLICK_OFF = 0,      /**< No multiple click handling (disabled). */
-    BTN_MULTIPLE_CLICK_NORMAL_MODE,  /**< Normal mode for multiple click detection.
-                                      */
-    BTN_MULTIPLE_CLICK_COMBINED_MODE /**< Combined mode for handling click cycles.
-                                      */
-} MultipleClickMode_t;
+BTN_operate_status ButtonCaptureInit(button_capture_t *Capture, button_capture_record_t *Records, uint16_t Capacity);
 
 /**
- * @brief Enum for operation status codes.
- * This enumeration defines the status codes returned by button library
- * functions to indicate success or failure of operations.
- * @note BTN_OK indicates a successful operation, while BTN_ERROR indicates an
- * error occurred during the operation.
+ * @brief Attaches a capture to a group, or detaches it.
+ *
+ * Every port snapshot the group processes (`ButtonGroupTask()` and
+ * `ButtonGroupProcessBlock()`) is recorded, at the tick it is processed for.
+ *
+ * @param Group Pointer to the group.
+ * @param Capture Pointer to an initialized capture, or NULL to stop capturing.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
  */
-typedef enum
-{
-    BTN_OK = 0,   /**< Operation completed successfully. */
-    BTN_ERROR = 1 /**< An error occurred during the operation. */
-} BTN_operate_status;
+BTN_operate_status ButtonGroupSetCapture(button_group_t *Group, button_capture_t *Capture);
 
 /**
- * @brief Button structure used for managing the state and behavior of a button.
+ * @brief Stops recording, keeping the captured trace.
  *
- * This structure holds all the necessary information for managing a button,
- * including its current state, GPIO settings, timers for debouncing, long
- * press, repeat, and multiple clicks, as well as function pointers for button
- * event callbacks (e.g., pressed, long pressed, release, etc.).
+ * Safe to call from a callback or an interrupt handler, e.g. right after a
+ * suspicious event, so the waveform that produced it is preserved.
  *
- * @note The structure is intended to be used with functions for handling button
- * debouncing, state transitions, and event callbacks.
+ * @param Capture Pointer to the capture.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
  */
-typedef struct
-{
-    ButtonState_t State;             /**< Current state of the button. */
-    GPIO_TypeDef *GpioPort;          /**< GPIO port where the button is connected. */
-    BTN_GPIO_PIN_T GpioPin;          /**< GPIO pin where the button is connected. */
-    BTN_TIME_t LastTick;             /**< Timestamp of the last button event. */
-    BTN_TIME_t TimerDebounce;        /**< Debounce time in milliseconds. */
-    BTN_TIME_t TimerLongPressed;     /**< Time threshold for a long press. */
-    BTN_TIME_t TimerRepeat;          /**< Repeat time threshold for repeated presses. */
-    ReverseLogicGpio_t ReverseLogic; /**< Logic level inversion for the button (if
-                                        applicable). */
-    uint16_t NumberBtn;              /**< Identifier for the button (used in callbacks). */
-#if BTN_DOUBLE_DEBOUNCING
-    ButtonState_t StateBeforeRelease;  /**< Previous button state before entering
-                                          the release state. */
-    BTN_TIME_t TimerSecondDebounce;    /**< Debounce time for the release state in
-                                          milliseconds. */
-    BTN_TIME_t LastTickSecondDebounce; /**< Timestamp of the last event during the
-                                          release debounce phase. */
-#endif
-    void (*ButtonPressed)(uint16_t);     /**< Callback function for button press event. */
-    void (*ButtonLongPressed)(uint16_t); /**< Callback function for long press event. */
-    void (*ButtonRepeat)(uint16_t);      /**< Callback function for repeat press event. */
-    void (*ButtonRelease)(uint16_t);     /**< Callback function for button release event. */
-#if BTN_RELEASE_AFTER_REPEAT
-    void (*ButtonReleaseAfterRepeat)(uint16_t); /**< Callback function for release event after repeat. */
-#endif
-#if BTN_MULTIPLE_CLICK
-    void (*ButtonDoubleClick)(uint16_t); /**< Callback function for double-click event. */
-    void (*ButtonTripleClick)(uint16_t); /**< Callback function for triple-click event. */
+BTN_operate_status ButtonCaptureFreeze(button_capture_t *Capture);
 
-    MultipleClickMode_t MultipleClickMode; /**< Mode for multiple click handling. */
-    uint8_t ClickCounter : 6;              /**< Counter for tracking number of clicks. */
-    uint8_t ClickCounterCycle : 1;         /**< Flag indicating cycle completion. */
-    uint8_t CombinedModeRepeatPressEx : 1; /**< Flag for combined mode repeat
-                                              press. */
-    uint32_t TimerBetweenClick;            /**< Time between multiple clicks. */
-    uint32_t LastClickTick;                /**< Timestamp of the last click event. */
+/**
+ * @brief Exports a frozen capture as a replayable trace.
+ *
+ * The trace starts with one record per captured port carrying its level before
+ * the oldest stored record, followed by the stored records from the oldest to
+ * the newest. Tick 0 of the trace is the tick of the oldest known level.
+ *
+ * @param Capture Pointer to a frozen capture.
+ * @param Records Output: trace records.
+ * @param Capacity Number of records `Records` can hold (at least the number of
+ * captured ports plus the stored records).
+ * @param Count Output: number of exported records.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if the capture is not frozen or `Records` is too small.
+ */
+BTN_operate_status ButtonCaptureExport(const button_capture_t *Capture, button_capture_record_t *Records,
+                                       uint16_t Capacity, uint16_t *Count);
 #endif
-#if BTN_NON_USED_CALLBACK
-    BTN_TIME_t TimerNonUsed;
-    void (*ButtonNonUsed)(uint16_t);
 #endif
-} button_t;
 
+#if BTN_EVENT_QUEUE
 /**
- * @brief Registers the time source for the button library tick mechanism.
- *
- * This function is used to provide the button library with a time base for
- * managing timeouts, delays, and transition timing. Depending on the
- * configuration (`BT_TICK_FROM_FUNC`), the user must provide either a function
- * that returns the current time or a pointer to a variable representing the
- * current time.
+ * @brief Runs the callbacks of all queued button events.
  *
- * - If `BT_TICK_FROM_FUNC` is set to 1, call `BT_tick_function_register()` with
- * a function that returns the current tick value.
- * - If `BT_TICK_FROM_FUNC` is set to 0, call `BT_tick_variable_register()` with
- * a pointer to a variable that is periodically updated with the current tick
- * value.
+ * With `BTN_EVENT_QUEUE` enabled, `ButtonTask` / `ButtonGroupTask` only queue
+ * events, so they can run from a timer interrupt. This function drains the
+ * queue and calls the registered callbacks; call it from the main loop.
  *
- * @param Function Pointer to the function returning the current time tick (only
- * if `BT_TICK_FROM_FUNC` is 1).
- * @param Variable Pointer to the time tick variable (only if
- * `BT_TICK_FROM_FUNC` is 0).
- * @return BT_OK if registration was successful; an error code otherwise.
+ * @retval Status of the dispatch:
+ *         - `BTN_OK` if all events were delivered.
+ *         - `BTN_ERROR` if events were dropped because the queue was full
+ *           since the previous call.
  */
-#if SM_TICK_FROM_FUNC
-BTN_operate_status BTN_tick_function_register(BTN_TIME_t (*Function)(void));
-#else
-BTN_operate_status BTN_tick_variable_register(BTN_TIME_t *Variable);
-#endif
+BTN_operate_status ButtonDispatchEvents(void);
 
-/* ========================== Initialization Functions =========================
- */
+#if BTN_EVENT_QUEUE_COUNT > 1
 /**
- * @brief Initializes a button structure with the provided parameters.
- * @param Key Pointer to the button structure to initialize.
- * @param GpioPort GPIO port where the button is connected.
- * @param GpioPin GPIO pin where the button is connected.
- * @param TimerDebounce Debounce time in milliseconds to filter button noise.
- * @param TimerLongPressed Time in milliseconds to detect a long press.
- * @param TimerRepeat Time in milliseconds for repeated press events.
- * @param ReverseLogic Indicates whether the GPIO uses reverse logic
- * (active-low).
- * @param Number Button identifier passed to callback functions.
- * @retval Status of the initialization:
- *         - `BTN_OK` if initialization is successful.
- *         - `BTN_ERROR` if there was an error during initialization.
+ * @brief Selects the event queue receiving the events of a button.
+ *
+ * Every queue has a single producer, so buttons processed in different
+ * contexts have to use different queues. Call it while the button is not being
+ * processed.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Queue Index of the queue (below `BTN_EVENT_QUEUE_COUNT`).
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
  */
-BTN_operate_status ButtonInitKey(button_t *Key, GPIO_TypeDef *GpioPort, uint16_t GpioPin, BTN_TIME_t TimerDebounce,
-                                 BTN_TIME_t TimerLongPressed, BTN_TIME_t TimerRepeat, ReverseLogicGpio_t ReverseLogic,
-                                 uint16_t Number); // Initialization for state machine
-#if BTN_DEFAULT_INIT
+BTN_operate_status ButtonSetEventQueue(button_t *Key, uint8_t Queue);
+
+#if BTN_GROUP
 /**
- * @brief Initializes a button structure with default timing values.
- * @param Key Pointer to the button structure to initialize.
- * @param GpioPort GPIO port where the button is connected.
- * @param GpioPin GPIO pin where the button is connected.
- * @param ReverseLogic Indicates whether the GPIO uses reverse logic
- * (active-low).
- * @param Number Button identifier passed to callback functions.
+ * @brief Pins a group to an event queue.
  *
- * This function behaves similarly to `ButtonInitKey`, but uses predefined
- * default values for debounce time, long press time, and repeat time. These
- * values are defined as macros in the header file.
- * @retval Status of the initialization:
- *         - `BTN_OK` if initialization is successful.
- *         - `BTN_ERROR` if there was an error during initialization.
+ * The events of all buttons and chords of the group go to `Queue`, so the
+ * group can be processed on its own core or RTOS task without sharing a queue
+ * producer with other contexts. Call it while the group is not being
+ * processed.
+ *
+ * @param Group Pointer to the group.
+ * @param Queue Index of the queue (below `BTN_EVENT_QUEUE_COUNT`).
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
  */
-BTN_operate_status ButtonInitKeyDefault(button_t *Key, GPIO_TypeDef *GpioPort, uint16_t GpioPin,
-                                        ReverseLogicGpio_t ReverseLogic, uint16_t Number);
+BTN_operate_status ButtonGroupSetEventQueue(button_group_t *Group, uint8_t Queue);
+#endif
+#endif
 #endif
 
-#if BTN_MULTIPLE_CLICK
+#if BTN_ATOMIC_CONFIG
 /**
- * @brief Sets the multiple click mode and the timer between clicks for the
- * button.
+ * @brief Gives a button two buffers for atomic reconfiguration.
  *
- * This function configures the button to operate in different multiple click
- * modes, such as normal or combined, and sets the time between consecutive
- * clicks.
+ * From then on the `ButtonSet*` and `ButtonRegister*` functions copy the
+ * button's current configuration into the buffer the button is not using,
+ * modify the copy and publish it with a single pointer store. The button
+ * adopts it at the start of its next pass, so the task never sees a partly
+ * written configuration and never takes a lock. While a published change has
+ * not been adopted yet, further changes of the button fail with `BTN_ERROR`
+ * (see `ButtonConfigPending()`).
+ *
+ * All changes of one button have to come from a single context, which should
+ * also run `ButtonDispatchEvents()`; different buttons may be changed from
+ * different contexts.
  *
  * @param Key Pointer to the button structure.
- * @param MultipleClickMode The mode to handle multiple clicks (e.g.,
- * BTN_MULTIPLE_CLICK_OFF, BTN_MULTIPLE_CLICK_NORMAL_MODE).
- * @param TimerBetweenClick Time in milliseconds between two clicks that are
- * considered part of the same multiple click event.
- * @retval Status of the configuration:
- *         - `BTN_OK` if the configuration was successful.
- *         - `BTN_ERROR` if there was an error during configuration.
+ * @param Buffers Array of two configurations owned by the button from now on,
+ * or NULL to modify the configuration in place again.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
  */
-BTN_operate_status ButtonSetMultipleClick(button_t *Key, MultipleClickMode_t MultipleClickMode,
-                                          uint32_t TimerBetweenClick);
-#endif
+BTN_operate_status ButtonSetConfigBuffers(button_t *Key, button_config_t *Buffers);
 
-#if BTN_NON_USED_CALLBACK
 /**
- * @brief Configures the non-used (idle) behavior for a button.
+ * @brief Publishes a new configuration for a button.
  *
- * This function sets the duration of inactivity (in milliseconds) required to
- * trigger the non-used callback for a specific button. It also assigns the
- * callback function to be called when the button is considered unused.
+ * The button switches to `Config` at the start of its next pass. `Config` must
+ * stay valid and unchanged while the button uses it.
  *
- * @param Key Pointer to the button instance.
- * @param Miliseconds Time in milliseconds after which the button is considered
- * non-used. If set to 0, the non-used functionality is disabled for this
- * button.
- * @param Callback Pointer to the function to be executed when the button is
- * unused.
- * @return BTN_OK if the configuration was successful; an error code otherwise.
+ * @param Key Pointer to the button structure.
+ * @param Config Pointer to the new configuration.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the configuration was published.
+ *         - `BTN_ERROR` if a pointer is NULL or a previous change is still
+ *           pending.
+ */
+BTN_operate_status ButtonPublishConfig(button_t *Key, const button_config_t *Config);
+
+/**
+ * @brief Checks whether a published configuration waits to be adopted.
  *
- * @note This feature is available only if `BTN_NON_USED_CALLBACK` is set to 1.
+ * @param Key Pointer to the button structure.
+ * @retval 1 while the button has not adopted the last published
+ * configuration, 0 otherwise.
  */
-BTN_operate_status ButtonSetNonUsed(button_t *Key, BTN_TIME_t Miliseconds, void *Callback);
+uint8_t ButtonConfigPending(const button_t *Key);
 #endif
 
-/* =================================== State machine
- * ================================== */
 /**
- * @brief Handles the button state machine and triggers appropriate routines.
- *
- * This function manages the button state transitions and calls the
- * corresponding routine based on the button's current state. It should be
- * called in the main loop or system task.
+ * @brief Reports the info record of the event being delivered.
  *
- * @param Key Pointer to the button structure being processed.
+ * Intended for callbacks, which receive only the button number: called from a
+ * callback, it returns the tick, press duration, repeat and click counts of
+ * the event that callback runs for, as the event handler receives them.
  *
- * @retval Status of the button task:
- *         - `BTN_OK` if the task executed successfully.
- *         - `BTN_ERROR` if there was an error during execution.
+ * @param Info Output: info record of the current event.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if `Info` is NULL or no event is being delivered.
  */
-BTN_operate_status ButtonTask(button_t *Key); // Task for working state machine
+BTN_operate_status ButtonGetEventInfo(button_event_info_t *Info);
 
 /* ========================== Callback Registration Functions
  * ========================= */
+#if BTN_EVENT_HANDLER
+/**
+ * @brief Registers the event handler of a button (`BTN_EVENT_HANDLER` mode).
+ *
+ * All events of the button whose bit is set in `EventMask` are delivered to
+ * `Handler`; the per-event `ButtonRegister*Callback` functions are not
+ * available in this mode.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Handler Pointer to the event handler, or NULL to disable delivery.
+ * @param EventMask Mask of enabled events built with `BTN_EVENT_MASK()` (or
+ * `BTN_EVENT_MASK_ALL`).
+ * @retval Status of the registration:
+ *         - `BTN_OK` if registration was successful.
+ *         - `BTN_ERROR` if there was an error during registration.
+ */
+BTN_operate_status ButtonRegisterEventHandler(button_t *Key, button_event_handler_t Handler, uint16_t EventMask);
+
+#if BTN_GROUP
+/**
+ * @brief Registers one event handler for all buttons of a group.
+ *
+ * @param Group Pointer to the group.
+ * @param Handler Pointer to the event handler, or NULL to disable delivery.
+ * @param EventMask Mask of enabled events built with `BTN_EVENT_MASK()`.
+ * @retval Status of the registration:
+ *         - `BTN_OK` if registration was successful.
+ *         - `BTN_ERROR` if there was an error during registration.
+ */
+BTN_operate_status ButtonGroupRegisterEventHandler(button_group_t *Group, button_event_handler_t Handler,
+                                                   uint16_t EventMask);
+#endif
+#else
 /**
  * @brief Registers a callback function for the button press event.
  *
@@ -420,6 +1794,51 @@ BTN_operate_status ButtonRegisterDoubleClickCallback(button_t *Key, void *Callba
  *         - `BTN_ERROR` if there was an error during registration.
  */
 BTN_operate_status ButtonRegisterTripleClickCallback(button_t *Key, void *Callback);
+
+/**
+ * @brief Registers a callback function for finished click sequences.
+ *
+ * The callback `void ButtonClickCount(uint16_t Number, uint8_t Clicks)` is
+ * called for buttons with a maximum click count (`ButtonSetMaxClicks()`) in
+ * combined mode, replacing the press, double click and triple click callbacks
+ * for click sequences.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Callback Pointer to the callback function.
+ * @retval Status of the registration:
+ *         - `BTN_OK` if registration was successful.
+ *         - `BTN_ERROR` if there was an error during registration.
+ */
+BTN_operate_status ButtonRegisterClickCountCallback(button_t *Key, void *Callback);
+#endif
+
+#if BTN_ENCODER
+/**
+ * @brief Registers a callback function for clockwise encoder detents.
+ *
+ * The step multiplier of the detent can be read with `ButtonGetEventInfo()`.
+ *
+ * @param Key Pointer to the encoder's virtual button (`&Encoder->Key`).
+ * @param Callback Pointer to the callback function.
+ * @retval Status of the registration:
+ *         - `BTN_OK` if registration was successful.
+ *         - `BTN_ERROR` if there was an error during registration.
+ */
+BTN_operate_status ButtonRegisterRotateCwCallback(button_t *Key, void *Callback);
+
+/**
+ * @brief Registers a callback function for counter-clockwise encoder detents.
+ *
+ * The step multiplier of the detent can be read with `ButtonGetEventInfo()`.
+ *
+ * @param Key Pointer to the encoder's virtual button (`&Encoder->Key`).
+ * @param Callback Pointer to the callback function.
+ * @retval Status of the registration:
+ *         - `BTN_OK` if registration was successful.
+ *         - `BTN_ERROR` if there was an error during registration.
+ */
+BTN_operate_status ButtonRegisterRotateCcwCallback(button_t *Key, void *Callback);
+#endif
 #endif
 
 /* ========================== Time Settings Functions =========================
@@ -439,6 +1858,45 @@ BTN_operate_status ButtonRegisterTripleClickCallback(button_t *Key, void *Callba
  */
 BTN_operate_status ButtonSetDebounceTime(button_t *Key, BTN_TIME_t Miliseconds);
 
+#if BTN_SAMPLE_DEBOUNCE
+/**
+ * @brief Selects sample count debouncing for the button.
+ *
+ * With a non-zero `Samples` the button settles in `DEBOUNCE` (and
+ * `DEBOUNCE_RELEASE`) once `Samples` consecutive task passes sampled the same
+ * level; any change restarts the count. One pass is one `ButtonTask()` or
+ * `ButtonGroupTask()` call, so the debounce time is `Samples` times the task
+ * period. `TimerDebounce` / `TimerSecondDebounce` and the adaptive windows are
+ * not used in this mode.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Samples Number of identical samples (1 to `BTN_SAMPLE_DEBOUNCE_MAX`),
+ * or 0 for time based debouncing.
+ * @retval Status of the configuration:
+ *         - `BTN_OK` if the configuration was successful.
+ *         - `BTN_ERROR` if there was an error during configuration.
+ */
+BTN_operate_status ButtonSetDebounceSamples(button_t *Key, uint8_t Samples);
+#endif
+
+#if BTN_LEADING_EDGE
+/**
+ * @brief Enables or disables leading edge press detection for the button.
+ *
+ * In leading edge mode the transition out of `IDLE` fires the press event
+ * immediately, without waiting for the debounce window. A lockout of
+ * `TimerDebounce` then ignores further edges, after the press and again after
+ * the release; the release is debounced as usual.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Enable 1 to fire presses on the leading edge, 0 to debounce them.
+ * @retval Status of the configuration:
+ *         - `BTN_OK` if the configuration was successful.
+ *         - `BTN_ERROR` if there was an error during configuration.
+ */
+BTN_operate_status ButtonSetLeadingEdge(button_t *Key, uint8_t Enable);
+#endif
+
 #if BTN_DOUBLE_DEBOUNCING
 /**
  * @brief Sets the debounce time for button release handling.
@@ -457,6 +1915,40 @@ BTN_operate_status ButtonSetDebounceTime(button_t *Key, BTN_TIME_t Miliseconds);
 BTN_operate_status ButtonSetReleaseDebounceTime(button_t *Key, BTN_TIME_t Miliseconds);
 #endif
 
+#if BTN_ADAPTIVE_DEBOUNCE
+/**
+ * @brief Enables adaptive debouncing of a button within the given bounds.
+ *
+ * The button starts with a `MaxTime` window and moves it towards its measured
+ * contact settling time plus `BTN_ADAPTIVE_DEBOUNCE_MARGIN`, separately for
+ * press and release. A glitch that brings a held button back from
+ * `DEBOUNCE_RELEASE` extends the press window. The fixed debounce times are
+ * used again once `MaxTime` is 0.
+ *
+ * @param Key Pointer to the button structure.
+ * @param MinTime Shortest debounce window.
+ * @param MaxTime Longest debounce window, or 0 to disable adaptation.
+ * @retval Status of the configuration:
+ *         - `BTN_OK` if the configuration was successful.
+ *         - `BTN_ERROR` if there was an error during configuration (including
+ *           `MinTime` greater than a non-zero `MaxTime`).
+ */
+BTN_operate_status ButtonSetAdaptiveDebounce(button_t *Key, BTN_TIME_t MinTime, BTN_TIME_t MaxTime);
+
+/**
+ * @brief Reports the debounce windows currently used by a button.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Press Output: press debounce window.
+ * @param Release Output: release debounce window, 0 without
+ * `BTN_DOUBLE_DEBOUNCING` (may be NULL).
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGetDebounceTime(const button_t *Key, BTN_TIME_t *Press, BTN_TIME_t *Release);
+#endif
+
 /**
  * @brief Sets the long press time for the button.
  *
@@ -486,6 +1978,41 @@ BTN_operate_status ButtonSetLongPressedTime(button_t *Key, BTN_TIME_t Milisecond
  */
 BTN_operate_status ButtonSetRepeatTime(button_t *Key, BTN_TIME_t Miliseconds);
 
+#if BTN_REPEAT_PROFILE
+/**
+ * @brief Sets the repeat acceleration profile of the button.
+ *
+ * While the button is held after a long press, stage 0 of `Profile` sets the
+ * repeat interval and step; each next stage takes over once the button has
+ * repeated `After` times. The step is reported in `button_event_info_t::Step`
+ * in handler mode and through `ButtonGetRepeatStep()` otherwise. The table is
+ * referenced, not copied, so a `const` table can be shared by many
+ * configurations.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Profile Pointer to the stage table, or NULL for fixed `TimerRepeat`
+ * repeats.
+ * @param Count Number of stages in `Profile`.
+ * @retval Status of the configuration:
+ *         - `BTN_OK` if the configuration was successful.
+ *         - `BTN_ERROR` if there was an error during configuration (including
+ *           an empty, unsorted or zero interval table).
+ */
+BTN_operate_status ButtonSetRepeatProfile(button_t *Key, const button_repeat_stage_t *Profile, uint8_t Count);
+
+/**
+ * @brief Reports the step multiplier of the button's current repeat.
+ *
+ * @param Key Pointer to the button structure.
+ * @param Step Output: step of the current repeat profile stage (1 without a
+ * profile).
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonGetRepeatStep(const button_t *Key, uint16_t *Step);
+#endif
+
 #if BTN_MULTIPLE_CLICK
 /**
  * @brief Sets the time between multiple clicks.
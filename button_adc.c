@@ -0,0 +1,228 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+#include "button_adc.h"
+#include <stddef.h>
+
+#if BTN_ADC_LADDER
+
+/* ========================== Helper Functions ========================= */
+/**
+ * @brief Checks whether a value lies in the range of a key widened by the
+ * hysteresis.
+ *
+ * @param Adc Pointer to the ladder structure.
+ * @param Key Key index, or `BTN_ADC_NO_KEY` for the released range.
+ * @param Value ADC conversion result.
+ * @return 1 if the value lies in the widened range, 0 otherwise.
+ */
+static uint8_t ButtonAdcInBand(const button_adc_t *Adc, uint8_t Key, uint16_t Value)
+{
+    uint8_t Index = (Key == BTN_ADC_NO_KEY) ? Adc->KeysCount : Key;
+    uint32_t Low = 0;
+
+    if (Index != 0U)
+    {
+        Low = Adc->Thresholds[Index - 1U];
+        Low = (Low > Adc->Hysteresis) ? (Low - Adc->Hysteresis) : 0U;
+    }
+    if (Value < Low)
+    {
+        return 0;
+    }
+    return Index == Adc->KeysCount || (uint32_t)Value < (uint32_t)Adc->Thresholds[Index] + Adc->Hysteresis;
+}
+
+/**
+ * @brief Maps an ADC value to a key index.
+ *
+ * The currently decoded key is kept as long as the value stays in its range
+ * widened by the hysteresis. Otherwise the key is looked up with a binary search
+ * for the first threshold above the value, in O(log K).
+ *
+ * @param Adc Pointer to the ladder structure.
+ * @param Value ADC conversion result.
+ * @return The decoded key index, or `BTN_ADC_NO_KEY`.
+ */
+static uint8_t ButtonAdcDecode(const button_adc_t *Adc, uint16_t Value)
+{
+    uint8_t Low = 0;
+    uint8_t High = Adc->KeysCount;
+
+    if (ButtonAdcInBand(Adc, Adc->Current, Value))
+    {
+        return Adc->Current;
+    }
+
+    while (Low < High)
+    {
+        uint8_t Mid = (uint8_t)((Low + High) / 2U);
+
+        if (Value < Adc->Thresholds[Mid])
+        {
+            High = Mid;
+        }
+        else
+        {
+            Low = (uint8_t)(Mid + 1U);
+        }
+    }
+    return (Low == Adc->KeysCount) ? BTN_ADC_NO_KEY : Low;
+}
+
+/**
+ * @brief Decodes one conversion and feeds the result into all keys.
+ *
+ * @param Adc Pointer to the ladder structure.
+ * @param Value ADC conversion result.
+ * @param Now Tick at which the conversion was taken.
+ *
+ * @return None
+ */
+static void ButtonAdcProcess(button_adc_t *Adc, uint16_t Value, BTN_TIME_t Now)
+{
+    Adc->Current = ButtonAdcDecode(Adc, Value);
+    for (uint8_t i = 0; i < Adc->KeysCount; i++)
+    {
+        ButtonFeedInput(&Adc->Keys[i], i == Adc->Current, Now);
+    }
+}
+
+/* ========================== Initialization Functions =========================
+ */
+/**
+ * @brief Initializes a resistor ladder ADC input and its keys.
+ *
+ * @param Adc Pointer to the ladder structure to initialize.
+ * @param Keys Array of `KeysCount` buttons.
+ * @param Thresholds Strictly ascending upper bound of every key's ADC range.
+ * @param KeysCount Number of keys (1 to 254).
+ * @param Hysteresis Widening of the decoded key's range in ADC counts.
+ * @param Config Timing and callback configuration shared by all keys.
+ * @param FirstNumber Identifier of the first key passed to callbacks.
+ * @return Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if an error occurs during initialization.
+ */
+BTN_operate_status ButtonAdcInit(button_adc_t *Adc, button_t *Keys, const uint16_t *Thresholds, uint8_t KeysCount,
+                                 uint16_t Hysteresis, const button_config_t *Config, uint16_t FirstNumber)
+{
+    if (Adc == NULL || Keys == NULL || Thresholds == NULL || Config == NULL || KeysCount == 0U ||
+        KeysCount == BTN_ADC_NO_KEY)
+    {
+        return BTN_ERROR;
+    }
+
+    for (uint8_t i = 0; i < KeysCount; i++)
+    {
+        if (i != 0U && Thresholds[i] <= Thresholds[i - 1U])
+        {
+            return BTN_ERROR;
+        }
+        if (ButtonInitKeyBit(&Keys[i], i, Config, (uint16_t)(FirstNumber + i)) != BTN_OK)
+        {
+            return BTN_ERROR;
+        }
+    }
+
+    Adc->Keys = Keys;
+    Adc->Thresholds = Thresholds;
+    Adc->KeysCount = KeysCount;
+    Adc->Hysteresis = Hysteresis;
+    Adc->Current = BTN_ADC_NO_KEY;
+    return BTN_OK;
+}
+
+/* =================================== Processing
+ * ================================== */
+/**
+ * @brief Decodes one ADC conversion and runs the state machines of all keys.
+ *
+ * @param Adc Pointer to the ladder structure.
+ * @param Value ADC conversion result.
+ * @return Status of the task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonAdcTask(button_adc_t *Adc, uint16_t Value)
+{
+    return ButtonAdcTaskAt(Adc, Value, ButtonGetTick());
+}
+
+/**
+ * @brief Decodes one ADC conversion at an explicitly given tick.
+ *
+ * @param Adc Pointer to the ladder structure.
+ * @param Value ADC conversion result.
+ * @param Now Current tick.
+ * @return Status of the task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonAdcTaskAt(button_adc_t *Adc, uint16_t Value, BTN_TIME_t Now)
+{
+    if (Adc == NULL || Adc->Keys == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    ButtonAdcProcess(Adc, Value, Now);
+    return BTN_OK;
+}
+
+/**
+ * @brief Processes a block of ADC conversions from a continuous DMA stream.
+ *
+ * @param Adc Pointer to the ladder structure.
+ * @param Samples Conversion results, oldest first.
+ * @param SamplesCount Number of samples.
+ * @param SamplePeriod Ticks between two consecutive samples.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the block was processed successfully.
+ *         - `BTN_ERROR` if there was an error during processing.
+ */
+BTN_operate_status ButtonAdcProcessBlock(button_adc_t *Adc, const uint16_t *Samples, uint16_t SamplesCount,
+                                         BTN_TIME_t SamplePeriod)
+{
+    return ButtonAdcProcessBlockAt(Adc, Samples, SamplesCount, SamplePeriod, ButtonGetTick());
+}
+
+/**
+ * @brief Processes a block of ADC conversions with an explicitly given tick of
+ * the last sample.
+ *
+ * @param Adc Pointer to the ladder structure.
+ * @param Samples Conversion results, oldest first.
+ * @param SamplesCount Number of samples.
+ * @param SamplePeriod Ticks between two consecutive samples.
+ * @param Now Tick of the last sample of the block.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the block was processed successfully.
+ *         - `BTN_ERROR` if there was an error during processing.
+ */
+BTN_operate_status ButtonAdcProcessBlockAt(button_adc_t *Adc, const uint16_t *Samples, uint16_t SamplesCount,
+                                           BTN_TIME_t SamplePeriod, BTN_TIME_t Now)
+{
+    BTN_TIME_t SampleTick;
+
+    if (Adc == NULL || Adc->Keys == NULL || Samples == NULL || SamplesCount == 0U)
+    {
+        return BTN_ERROR;
+    }
+
+    SampleTick = (BTN_TIME_t)(Now - (BTN_TIME_t)((SamplesCount - 1U) * SamplePeriod));
+    for (uint16_t Sample = 0; Sample < SamplesCount; Sample++)
+    {
+        ButtonAdcProcess(Adc, Samples[Sample], SampleTick);
+        SampleTick = (BTN_TIME_t)(SampleTick + SamplePeriod);
+    }
+    return BTN_OK;
+}
+
+#endif
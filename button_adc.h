@@ -0,0 +1,125 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+
+#ifndef INC_BUTTON_ADC_H_
+#define INC_BUTTON_ADC_H_
+
+#include "button.h"
+
+#if BTN_ADC_LADDER
+
+/**
+ * @brief Value of `Current` when no key of the ladder is pressed.
+ */
+#define BTN_ADC_NO_KEY 0xFFU
+
+/**
+ * @brief Structure of a resistor ladder ADC input.
+ *
+ * The keys are ordered by increasing ADC value. `Thresholds[i]` is the upper
+ * bound (exclusive) of the ADC range of key `i`; values from
+ * `Thresholds[KeysCount - 1]` up mean that no key is pressed. Once a key has
+ * been decoded, its range is widened by `Hysteresis` on both sides, so a value
+ * noisy around a threshold does not toggle between two keys.
+ */
+typedef struct
+{
+    button_t *Keys;             /**< Keys of the ladder, by increasing ADC value. */
+    const uint16_t *Thresholds; /**< Ascending upper bound of every key's range. */
+    uint16_t Hysteresis;        /**< Widening of the decoded key's range. */
+    uint8_t KeysCount;          /**< Number of keys. */
+    uint8_t Current;            /**< Decoded key, or `BTN_ADC_NO_KEY`. */
+} button_adc_t;
+
+/**
+ * @brief Initializes a resistor ladder ADC input and its keys.
+ *
+ * Every key is initialized with `ButtonInitKeyBit()` using the shared
+ * configuration and numbered `FirstNumber + index`.
+ *
+ * @param Adc Pointer to the ladder structure to initialize.
+ * @param Keys Array of `KeysCount` buttons.
+ * @param Thresholds Strictly ascending upper bound of every key's ADC range.
+ * The table is referenced, not copied.
+ * @param KeysCount Number of keys (1 to 254).
+ * @param Hysteresis Widening of the decoded key's range in ADC counts.
+ * @param Config Timing and callback configuration shared by all keys.
+ * @param FirstNumber Identifier of the first key passed to callbacks.
+ * @retval Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if an error occurs during initialization.
+ */
+BTN_operate_status ButtonAdcInit(button_adc_t *Adc, button_t *Keys, const uint16_t *Thresholds, uint8_t KeysCount,
+                                 uint16_t Hysteresis, const button_config_t *Config, uint16_t FirstNumber);
+
+/**
+ * @brief Decodes one ADC conversion and runs the state machines of all keys.
+ *
+ * @param Adc Pointer to the ladder structure.
+ * @param Value ADC conversion result.
+ * @retval Status of the task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonAdcTask(button_adc_t *Adc, uint16_t Value);
+
+/**
+ * @brief Decodes one ADC conversion at an explicitly given tick.
+ *
+ * Same as `ButtonAdcTask()`, but all timing decisions use `Now`.
+ *
+ * @param Adc Pointer to the ladder structure.
+ * @param Value ADC conversion result.
+ * @param Now Current tick.
+ * @retval Status of the task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonAdcTaskAt(button_adc_t *Adc, uint16_t Value, BTN_TIME_t Now);
+
+/**
+ * @brief Processes a block of ADC conversions from a continuous DMA stream.
+ *
+ * Every sample is decoded and fed into the keys at the tick it was taken; the
+ * last one at the current tick.
+ *
+ * @param Adc Pointer to the ladder structure.
+ * @param Samples Conversion results, oldest first.
+ * @param SamplesCount Number of samples.
+ * @param SamplePeriod Ticks between two consecutive samples.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the block was processed successfully.
+ *         - `BTN_ERROR` if there was an error during processing.
+ */
+BTN_operate_status ButtonAdcProcessBlock(button_adc_t *Adc, const uint16_t *Samples, uint16_t SamplesCount,
+                                         BTN_TIME_t SamplePeriod);
+
+/**
+ * @brief Processes a block of ADC conversions with an explicitly given tick of
+ * the last sample.
+ *
+ * Sample `k` of the block is timed at `Now - (SamplesCount - 1 - k) *
+ * SamplePeriod`.
+ *
+ * @param Adc Pointer to the ladder structure.
+ * @param Samples Conversion results, oldest first.
+ * @param SamplesCount Number of samples.
+ * @param SamplePeriod Ticks between two consecutive samples.
+ * @param Now Tick of the last sample of the block.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the block was processed successfully.
+ *         - `BTN_ERROR` if there was an error during processing.
+ */
+BTN_operate_status ButtonAdcProcessBlockAt(button_adc_t *Adc, const uint16_t *Samples, uint16_t SamplesCount,
+                                           BTN_TIME_t SamplePeriod, BTN_TIME_t Now);
+
+#endif
+
+#endif /* INC_BUTTON_ADC_H_ */
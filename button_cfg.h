@@ -41,6 +41,81 @@
  */
 #define BTN_DOUBLE_DEBOUNCING 1
 
+/**
+ * @def BTN_ADAPTIVE_DEBOUNCE
+ * @brief Enables or disables adaptive debounce times.
+ *
+ * When this macro is set to 1, a button with adaptive debounce bounds
+ * (`ButtonSetAdaptiveDebounce()`) measures how long its contacts keep bouncing
+ * in `DEBOUNCE` and `DEBOUNCE_RELEASE` and uses the learnt settling time plus
+ * `BTN_ADAPTIVE_DEBOUNCE_MARGIN`, kept within the bounds, instead of the fixed
+ * debounce times. Fresh switches get a short press latency, worn ones a longer
+ * window.
+ *
+ * If set to 0, the debounce times are always the configured constants.
+ */
+#define BTN_ADAPTIVE_DEBOUNCE 1
+
+#if BTN_ADAPTIVE_DEBOUNCE
+/**
+ * @def BTN_ADAPTIVE_DEBOUNCE_MARGIN
+ * @brief Ticks added to the learnt settling time to form the debounce window.
+ */
+#define BTN_ADAPTIVE_DEBOUNCE_MARGIN 2
+
+/**
+ * @def BTN_ADAPTIVE_DEBOUNCE_DECAY
+ * @brief Decay rate of the learnt settling time, as a power of two.
+ *
+ * A longer bounce is adopted at once; a shorter one moves the learnt time down
+ * by 1/2^`BTN_ADAPTIVE_DEBOUNCE_DECAY` of the difference, so the window
+ * follows the worst recent bounces rather than the average.
+ */
+#define BTN_ADAPTIVE_DEBOUNCE_DECAY 3
+#endif
+
+/**
+ * @def BTN_SAMPLE_DEBOUNCE
+ * @brief Enables or disables sample count (integrating) debouncing.
+ *
+ * When this macro is set to 1, a button can be switched with
+ * `ButtonSetDebounceSamples()` to accept a press or release only after K
+ * consecutive task passes sampled the same level, instead of waiting a fixed
+ * time and reading the pin once. A single glitch restarts the count, so short
+ * windows still reject EMI spikes.
+ *
+ * If set to 0, debouncing is always time based.
+ */
+#define BTN_SAMPLE_DEBOUNCE 1
+
+/**
+ * @def BTN_LEADING_EDGE
+ * @brief Enables or disables leading edge (zero latency) press detection.
+ *
+ * When this macro is set to 1, a button switched with `ButtonSetLeadingEdge()`
+ * fires its press on the first active sample instead of after the debounce
+ * window, then ignores all edges for `TimerDebounce` after the press and after
+ * the release. The release is still debounced. This suits gaming and
+ * emergency stop inputs, which need the shortest possible latency.
+ *
+ * If set to 0, every press is debounced before it is reported.
+ */
+#define BTN_LEADING_EDGE 1
+
+/**
+ * @def BTN_REPEAT_PROFILE
+ * @brief Enables or disables accelerating auto-repeat profiles.
+ *
+ * When this macro is set to 1, a configuration can reference a table of
+ * `button_repeat_stage_t` stages (`ButtonSetRepeatProfile()`). While a button
+ * is held, the repeat interval and the step multiplier reported with every
+ * repeat change from stage to stage after a given number of repeats, so fast
+ * value entry needs no timers in the application.
+ *
+ * If set to 0, repeats always come every `TimerRepeat`.
+ */
+#define BTN_REPEAT_PROFILE 1
+
 /**
  * @def BTN_MULTIPLE_CLICK
  * @brief Enables or disables multiple click detection functionality.
@@ -87,6 +162,494 @@
  */
 #define BTN_NON_USED_CALLBACK 1
 
+/**
+ * @def BTN_TABLE_CORE
+ * @brief Selects the table-driven state machine core.
+ *
+ * When this macro is set to 1, every pass of a button is one lookup in a
+ * constant transition table indexed by the button state, its input level and
+ * whether the timer of the state has expired. Each cell names the next state
+ * and a short list of actions; actions of disabled features are compiled out
+ * of the table. A release is accepted and delivered by the same cell, so it
+ * reaches the user on the tick it is accepted, and no pass runs more than
+ * four actions, which keeps the worst case per button and tick easy to bound.
+ *
+ * If set to 0, a `switch` dispatches the states and a release event is
+ * delivered one pass after the release is accepted. It can also be set from
+ * the build, e.g. to run the host replay check on both cores.
+ */
+#ifndef BTN_TABLE_CORE
+#define BTN_TABLE_CORE 0
+#endif
+
+/**
+ * @def BTN_SHARED_CONFIG
+ * @brief Selects how a button stores its configuration.
+ *
+ * If set to 1, `button_t` only holds its runtime state and a pointer to a
+ * `button_config_t` (timings, callbacks, reverse logic). The configuration can
+ * be `const`, placed in flash and shared by many buttons, which saves most of
+ * the RAM per button. Buttons are initialized with `ButtonInitKeyConfig()`;
+ * `ButtonInitKey()` and `ButtonInitKeyDefault()` are not available.
+ *
+ * If set to 0, every button embeds its own copy of the configuration. It can
+ * also be set from the build.
+ */
+#ifndef BTN_SHARED_CONFIG
+#define BTN_SHARED_CONFIG 0
+#endif
+
+/**
+ * @def BTN_GROUP
+ * @brief Enables or disables the button group API.
+ *
+ * When this macro is set to 1, buttons can be collected into a
+ * `button_group_t` and processed with `ButtonGroupTask()`. The group reads
+ * every distinct GPIO port only once per call and evaluates all of its buttons
+ * on that snapshot, instead of reading the pin separately for every button.
+ *
+ * If set to 0, the group API is not compiled and `button_t` does not carry the
+ * port index used by the group.
+ */
+#define BTN_GROUP 1
+
+#if BTN_GROUP
+/**
+ * @def BTN_GROUP_MAX_PORTS
+ * @brief Maximum number of distinct GPIO ports a single button group can span.
+ *
+ * Each port costs one stored pointer and one snapshot word in every
+ * `button_group_t`. It can also be set from the build (e.g. the host
+ * simulation raises it to `BTN_SIM_MAX_PORTS`).
+ */
+#ifndef BTN_GROUP_MAX_PORTS
+#define BTN_GROUP_MAX_PORTS 4
+#endif
+
+/**
+ * @def BTN_GROUP_VERTICAL_DEBOUNCE
+ * @brief Enables or disables the bit-parallel debounce engine for groups.
+ *
+ * When this macro is set to 1, a group can debounce all pins of each of its
+ * ports at once with vertical counters (2-bit integrators stored as two
+ * bit-planes per port). A pin change is accepted after 4 consecutive samples
+ * with the new level, at the cost of a few bitwise operations per port and
+ * sample. Buttons of such a group never enter the `DEBOUNCE` and
+ * `DEBOUNCE_RELEASE` states; their `TimerDebounce` is not used.
+ *
+ * If set to 0, groups only provide batched reading and every button is
+ * debounced by its own timers.
+ */
+#define BTN_GROUP_VERTICAL_DEBOUNCE 1
+
+/**
+ * @def BTN_GROUP_ACTIVE_LIST
+ * @brief Enables or disables dispatching only the busy buttons of a group.
+ *
+ * When this macro is set to 1, a group keeps a bitmap of its busy buttons:
+ * those outside `IDLE`, or idle with a pending multiple click, non-used or
+ * lockout timer. New activity on the other buttons is found by XOR-ing every
+ * port snapshot against the previous one, so a pass only runs the state
+ * machines of busy buttons and of buttons whose input changed. The cost of a
+ * pass then grows with the number of touched buttons, not with the size of
+ * the group.
+ *
+ * If set to 0, every button of a group is processed on every pass.
+ */
+#define BTN_GROUP_ACTIVE_LIST 1
+
+#if BTN_GROUP_ACTIVE_LIST
+/**
+ * @def BTN_GROUP_MAX_KEYS
+ * @brief Maximum number of buttons in a single button group.
+ *
+ * Every `button_group_t` reserves one bit of its busy bitmap per button and,
+ * with `BTN_GROUP_TIMER_HEAP`, one 16-bit heap slot per button, whatever the
+ * size of the group; each pin of each group port costs one 16-bit button
+ * index. It can also be set from the build (e.g. the host simulation raises it
+ * to 256 for its benchmark).
+ */
+#ifndef BTN_GROUP_MAX_KEYS
+#define BTN_GROUP_MAX_KEYS 32
+#endif
+
+/**
+ * @def BTN_GROUP_TIMER_HEAP
+ * @brief Enables or disables the shared timer heap of groups.
+ *
+ * When this macro is set to 1, a button of a group that only waits for a timer
+ * (debounce end, long press, next repeat, end of the multiple click window,
+ * non-used time or lockout end) leaves the busy bitmap and is parked in a
+ * min-heap of the group, ordered by its deadline. A pass then pops only the
+ * expired entries instead of polling every timer, and
+ * `ButtonGroupGetNextDeadline()` reads the earliest parked deadline from the
+ * top of the heap. A parked button whose input changes is run right away.
+ *
+ * If set to 0, busy buttons poll their timers on every pass.
+ */
+#define BTN_GROUP_TIMER_HEAP 1
+#endif
+
+/**
+ * @def BTN_CHORD
+ * @brief Enables or disables chord (key combination) detection for groups.
+ *
+ * When this macro is set to 1, combinations of buttons of a group can be
+ * registered as `button_chord_t` objects. Every chord is a bitmask over the
+ * group's debounced pressed state, evaluated with one masked compare per port
+ * and pass, so its cost does not depend on the number of buttons in the group.
+ * A chord produces the regular button events through its own configuration.
+ *
+ * If set to 0, chords are not compiled.
+ */
+#define BTN_CHORD 1
+
+/**
+ * @def BTN_GROUP_SUSPEND
+ * @brief Enables or disables suspend/resume of button groups.
+ *
+ * When this macro is set to 1, a group can be suspended before the MCU enters
+ * a low-power mode that stops or compensates the tick. While suspended the
+ * group is not processed; on resume, all timestamps of its buttons are rebased
+ * in one pass by the ticks the tick source jumped, so no timer fires early and
+ * no press is measured wrong, and the button that woke the MCU can go straight
+ * into `DEBOUNCE`.
+ *
+ * If set to 0, suspend/resume is not compiled.
+ */
+#define BTN_GROUP_SUSPEND 1
+
+/**
+ * @def BTN_ENCODER
+ * @brief Enables or disables quadrature rotary encoders in button groups.
+ *
+ * When this macro is set to 1, `button_encoder_t` inputs can be attached to a
+ * group. Their two pins are decoded from the same port snapshot as the group's
+ * buttons, with one 16-entry transition table lookup per sample, and every
+ * detent is delivered as a `BTN_EVENT_ROTATE_CW` / `BTN_EVENT_ROTATE_CCW` event
+ * through the regular callback, handler and queue path, with a step multiplier
+ * that grows with the turning speed.
+ *
+ * If set to 0, encoders are not compiled.
+ */
+#define BTN_ENCODER 1
+
+/**
+ * @def BTN_CAPTURE
+ * @brief Enables or disables the capture of raw group input traces.
+ *
+ * When this macro is set to 1, a group can record every port snapshot it
+ * processes into a caller-provided ring buffer. Only changes are stored, as
+ * `{tick delta, port, value}` records in the format of the host simulation
+ * (`sim/button_sim.h`), so a trace taken in the field can be frozen, exported
+ * and replayed deterministically through the library on a PC. An unchanged
+ * sample costs one compare per port.
+ *
+ * If set to 0, capture is not compiled.
+ */
+#define BTN_CAPTURE 0
+#endif
+
+/**
+ * @def BTN_EVENT_QUEUE
+ * @brief Enables or disables deferred callback execution through an event
+ * queue.
+ *
+ * When this macro is set to 1, the state machine does not call user callbacks
+ * itself. Every event is pushed as a `{button, event, tick}` record into a
+ * lock-free single-producer/single-consumer ring buffer, and
+ * `ButtonDispatchEvents()` runs the callbacks later. This allows `ButtonTask`
+ * to run from a timer interrupt without slow callbacks stretching it.
+ *
+ * If set to 0, callbacks are called synchronously from `ButtonTask`. It can
+ * also be set from the build.
+ */
+#ifndef BTN_EVENT_QUEUE
+#define BTN_EVENT_QUEUE 0
+#endif
+
+#if BTN_EVENT_QUEUE
+/**
+ * @def BTN_EVENT_QUEUE_SIZE
+ * @brief Number of events the queue can hold (power of two, 2 to 128).
+ */
+#define BTN_EVENT_QUEUE_SIZE 32
+
+/**
+ * @def BTN_EVENT_QUEUE_COUNT
+ * @brief Number of independent event queues (1 to 8).
+ *
+ * Every queue has a single producer. When button tasks run in several
+ * contexts (cores or RTOS tasks), give each context its own queue with
+ * `ButtonSetEventQueue()` / `ButtonGroupSetEventQueue()`; buttons use queue 0
+ * by default. `ButtonDispatchEvents()` drains all queues.
+ */
+#define BTN_EVENT_QUEUE_COUNT 1
+
+/**
+ * @def BTN_MEMORY_BARRIER
+ * @brief Compiler barrier ordering the queue record and index accesses.
+ *
+ * The default is sufficient for a producer interrupt and a consumer on the same
+ * core. Define it as a hardware barrier (e.g. `__DMB()`) if producer and
+ * consumer run on different cores.
+ */
+#define BTN_MEMORY_BARRIER() __asm__ volatile("" ::: "memory")
+#endif
+
+/**
+ * @def BTN_ATOMIC_CONFIG
+ * @brief Enables atomic reconfiguration of buttons processed in another
+ * context.
+ *
+ * If set to 1, a button given two configuration buffers with
+ * `ButtonSetConfigBuffers()` is never modified in place: the `ButtonSet*` and
+ * `ButtonRegister*` functions edit a copy of its configuration and publish it
+ * with a single pointer store, which the button adopts at its next pass. The
+ * task never takes a lock. Requires `BTN_SHARED_CONFIG` and `BTN_EVENT_QUEUE`
+ * (with `BTN_MEMORY_BARRIER` as a hardware barrier on multi-core parts).
+ *
+ * If set to 0, configurations are always modified in place. It can also be
+ * set from the build.
+ */
+#ifndef BTN_ATOMIC_CONFIG
+#define BTN_ATOMIC_CONFIG 0
+#endif
+
+#if BTN_ATOMIC_CONFIG
+/**
+ * @def BTN_ATOMIC_INCREMENT
+ * @brief Atomically increments the configuration publish counter.
+ *
+ * Different buttons may be reconfigured from different contexts, and every
+ * publish increments one counter shared by all of them, so the increment must
+ * not be interrupted. The default uses the GCC/Clang `__atomic` builtins. On
+ * cores without exclusive load/store (Cortex-M0/M0+) define it with a critical
+ * section instead, e.g.
+ * `do { __disable_irq(); (Var)++; __enable_irq(); } while (0)`.
+ */
+#define BTN_ATOMIC_INCREMENT(Var) ((void)__atomic_fetch_add(&(Var), 1U, __ATOMIC_SEQ_CST))
+#endif
+
+/**
+ * @def BTN_EVENT_HANDLER
+ * @brief Selects single event handler mode instead of per-event callbacks.
+ *
+ * When this macro is set to 1, a button configuration holds one
+ * `button_event_handler_t` plus a mask of enabled events instead of a separate
+ * function pointer for every event. All events go through one call site and
+ * can be routed into one `switch` in the application. Handlers are registered
+ * with `ButtonRegisterEventHandler()` / `ButtonGroupRegisterEventHandler()`;
+ * the `ButtonRegister*Callback` functions are not available.
+ *
+ * If set to 0, every event has its own `void (*)(uint16_t)` callback.
+ */
+#define BTN_EVENT_HANDLER 0
+
+/**
+ * @def BTN_EVENT_PRESS_INFO
+ * @brief Enables or disables the press duration and repeat count of events.
+ *
+ * When this macro is set to 1, every button records the tick of its accepted
+ * press and counts its repeats, and `button_event_info_t` reports how long the
+ * button has been held with long press, repeat and release events, and how
+ * many repeats it produced. The application needs no tick reads and no state
+ * of its own to measure presses.
+ *
+ * If set to 0, `Duration` and `Repeats` are always 0, saving one timestamp and
+ * one counter per button.
+ */
+#define BTN_EVENT_PRESS_INFO 1
+
+/**
+ * @def BTN_EDGE_WAKEUP
+ * @brief Enables or disables the interrupt (EXTI) driven wake-up mode.
+ *
+ * When this macro is set to 1, buttons can be switched to edge wake-up mode
+ * with `ButtonSetEdgeWakeup()`. Such a button stops being polled while it is
+ * idle with no pending multiple click or non-used timer, and is woken into
+ * `DEBOUNCE` by `ButtonNotifyEdge()` / `ButtonGroupNotifyEdge()` called from
+ * the pin's EXTI interrupt handler.
+ *
+ * If set to 0, all buttons are polled on every task call.
+ */
+#define BTN_EDGE_WAKEUP 1
+
+/**
+ * @def BTN_MATRIX
+ * @brief Enables or disables the keypad matrix scanner (`button_matrix.c`).
+ *
+ * When this macro is set to 1, a `button_matrix_t` drives the rows of a keypad
+ * one at a time, reads all columns with one port read per row and feeds every
+ * key into the regular button state machine. All keys of a matrix share one
+ * timing configuration.
+ *
+ * If set to 0, the matrix scanner is not compiled.
+ */
+#define BTN_MATRIX 1
+
+#if BTN_MATRIX
+/**
+ * @def BTN_MATRIX_MAX_ROWS
+ * @brief Maximum number of rows of a keypad matrix.
+ */
+#define BTN_MATRIX_MAX_ROWS 8
+
+/**
+ * @def BTN_MATRIX_MAX_COLS
+ * @brief Maximum number of columns of a keypad matrix (at most 16).
+ *
+ * All columns of a matrix must be connected to the same GPIO port.
+ */
+#define BTN_MATRIX_MAX_COLS 8
+
+/**
+ * @def BTN_MATRIX_SETTLE_DELAY
+ * @brief Waits for the column lines to settle after a row has been driven.
+ *
+ * Called with the matrix `SettleCycles` between driving a row and reading the
+ * columns, unless it is 0. The default is a busy loop; it can be redefined,
+ * e.g. to a DWT cycle counter or timer based delay.
+ */
+#define BTN_MATRIX_SETTLE_DELAY(Cycles)                                                                                \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        for (volatile uint16_t SettleLoop = (Cycles); SettleLoop != 0U; SettleLoop--)                                  \
+        {                                                                                                              \
+        }                                                                                                              \
+    } while (0)
+#endif
+
+/**
+ * @def BTN_INPUT
+ * @brief Enables or disables bulk input backends (`button_input.c`).
+ *
+ * When this macro is set to 1, buttons can be bound to a bit of a
+ * `button_input_t` bitmap instead of a GPIO pin (`ButtonInitKeyBit()`). The
+ * bitmap is filled by a backend in one bus transfer per poll, e.g. from a
+ * 74HC165 shift register chain or an I2C/SPI port expander, optionally
+ * completed asynchronously by DMA.
+ *
+ * If set to 0, the input backends are not compiled.
+ */
+#define BTN_INPUT 1
+
+#if BTN_INPUT
+/**
+ * @def BTN_INPUT_MAX_BITS
+ * @brief Maximum number of input bits of a single `button_input_t`.
+ *
+ * Every input holds two bitmaps of this size (the one used by the buttons and
+ * the one being transferred).
+ */
+#define BTN_INPUT_MAX_BITS 64
+
+/**
+ * @def BTN_INPUT_TIMEOUT
+ * @brief Time after which an unfinished asynchronous transfer is abandoned.
+ *
+ * Measured in ticks from the start of the transfer. When the backend never
+ * reports the completion (a bus or DMA error, a missed interrupt), the next
+ * poll after this time stops the transfer through the backend's `Cancel` and
+ * starts a new one; the buttons keep the last completed bitmap in the meantime.
+ * A non-blocking backend without `Cancel` must stop its transfer within this
+ * time itself.
+ *
+ * If set to 0, a transfer is only ended by `ButtonInputComplete()` or
+ * `ButtonInputAbort()`.
+ */
+#define BTN_INPUT_TIMEOUT 100
+#endif
+
+/**
+ * @def BTN_ADC_LADDER
+ * @brief Enables or disables resistor ladder ADC inputs (`button_adc.c`).
+ *
+ * When this macro is set to 1, several buttons sharing one ADC pin through a
+ * resistor ladder can be handled by a `button_adc_t`. Every conversion is
+ * decoded once into a key index with a binary search over a sorted threshold
+ * table (with hysteresis) and fed into the state machines of all its keys.
+ *
+ * If set to 0, the ADC ladder input is not compiled.
+ */
+#define BTN_ADC_LADDER 1
+
+/**
+ * @def BTN_PIN_TABLE
+ * @brief Enables or disables compile-time pin description tables.
+ *
+ * When this macro is set to 1, GPIO buttons can be described by a `const`
+ * table of `button_pin_t` entries (built with `BTN_PIN()` or an X-macro list)
+ * and polled with `ButtonPinTableTask()`. The active level of every pin is
+ * folded into an XOR mask when the table is built, so reading a button is one
+ * input register load, an XOR and an AND, without a HAL call and without a
+ * branch on the reverse logic setting.
+ *
+ * If set to 0, buttons are read only through their runtime GPIO settings.
+ */
+#define BTN_PIN_TABLE 1
+
+/**
+ * @def BTN_STATIC_TABLE
+ * @brief Enables or disables statically defined buttons.
+ *
+ * When this macro is set to 1, buttons can be declared with an X-macro list
+ * that emits a `const` table of `button_static_t` entries (pin, active level,
+ * configuration and number) in flash and a zero-initialized `button_t` array
+ * in `.bss`. `ButtonStaticTask()` runs them without any initialization call,
+ * and configurations built with `BTN_CONFIG_STATIC()` reject invalid timing
+ * combinations at compile time. Requires `BTN_PIN_TABLE` and
+ * `BTN_SHARED_CONFIG`.
+ *
+ * If set to 0, buttons have to be initialized at runtime.
+ */
+#define BTN_STATIC_TABLE 0
+
+/**
+ * @def BTN_STATS
+ * @brief Enables or disables per-button runtime statistics.
+ *
+ * When this macro is set to 1, every button records how often its input
+ * bounced during debouncing, how often a debounce was aborted, the shortest,
+ * longest and histogram of its press durations, the longest gap between two
+ * passes of its state machine and the longest time spent in its callbacks.
+ * The counters are read with `ButtonGetStats()` and cleared with
+ * `ButtonResetStats()`.
+ *
+ * If set to 0, no statistics are kept and the state machine has no
+ * instrumentation code.
+ */
+#define BTN_STATS 0
+
+#if BTN_STATS
+/**
+ * @def BTN_STATS_HISTOGRAM_BINS
+ * @brief Number of bins of the press duration histogram.
+ */
+#define BTN_STATS_HISTOGRAM_BINS 8
+
+/**
+ * @def BTN_STATS_HISTOGRAM_SHIFT
+ * @brief Width of the first histogram bin, as a power of two of ticks.
+ *
+ * Bin 0 counts presses shorter than `1 << BTN_STATS_HISTOGRAM_SHIFT` ticks and
+ * every next bin is twice as wide as the previous one; the last bin counts all
+ * longer presses. With 5 and 8 bins at 1 ms per tick the bins are <32, <64,
+ * <128, <256, <512, <1024, <2048 and >=2048 ms.
+ */
+#define BTN_STATS_HISTOGRAM_SHIFT 5
+
+/**
+ * @def BTN_STATS_CLOCK
+ * @brief Clock used to measure the time spent in callbacks.
+ *
+ * The default is the library tick, which only catches callbacks longer than
+ * one tick. Define it as a cycle counter (e.g. `DWT->CYCCNT`) for a cycle
+ * accurate measurement.
+ */
+#define BTN_STATS_CLOCK() ((uint32_t)ButtonGetTick())
+#endif
+
 #if BTN_DEFAULT_INIT
 /**
  * @def BTN_DEFAULT_TIME_DEBOUNCE
@@ -128,6 +691,18 @@
  */
 #define BTN_USER_READ_PIN_ROUTINE 0
 
+#if BTN_USER_READ_PIN_ROUTINE
+/**
+ * @def BTN_READ_PIN
+ * @brief User-defined GPIO read routine.
+ *
+ * Must evaluate to non-zero when the pin `Pin` of `Port` reads high and to 0
+ * when it reads low, e.g. `#define BTN_READ_PIN(Port, Pin) MyReadPin((Port),
+ * (Pin))`.
+ */
+#define BTN_READ_PIN(Port, Pin) (((Port)->IDR & (Pin)) != 0U)
+#endif
+
 /**
  * @def BTN_GPIO_PORT_T
  * @brief Defines the data type for the GPIO port parameter.
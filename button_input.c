@@ -0,0 +1,353 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+#include "button_input.h"
+#include <string.h>
+
+#if BTN_INPUT
+
+#if BTN_FORCE_NON_HAL
+#undef USE_HAL_DRIVER
+#define HAL_TO_DEFINE
+#endif
+
+/* ========================== Helper Functions ========================= */
+/**
+ * @brief Drives a GPIO output pin.
+ *
+ * @param GPIOx Pointer to the GPIO port.
+ * @param GPIO_Pin The GPIO pin.
+ * @param Level Non-zero to drive the pin high, 0 to drive it low.
+ *
+ * @return None
+ */
+static void ButtonInputWritePin(BTN_GPIO_PORT_T *GPIOx, BTN_GPIO_PIN_T GPIO_Pin, uint8_t Level)
+{
+#ifdef USE_HAL_DRIVER
+    HAL_GPIO_WritePin(GPIOx, GPIO_Pin, Level ? GPIO_PIN_SET : GPIO_PIN_RESET);
+#else
+    GPIOx->BSRR = Level ? (uint32_t)GPIO_Pin : ((uint32_t)GPIO_Pin << 16);
+#endif
+}
+
+/**
+ * @brief Reads a GPIO input pin.
+ *
+ * @param GPIOx Pointer to the GPIO port.
+ * @param GPIO_Pin The GPIO pin.
+ * @return 1 if the pin is high, 0 if it is low.
+ */
+static uint8_t ButtonInputReadPin(BTN_GPIO_PORT_T *GPIOx, BTN_GPIO_PIN_T GPIO_Pin)
+{
+#ifdef USE_HAL_DRIVER
+    return HAL_GPIO_ReadPin(GPIOx, GPIO_Pin) == GPIO_PIN_SET;
+#else
+    return (GPIOx->IDR & GPIO_Pin) != 0U;
+#endif
+}
+
+/**
+ * @brief Makes the last completed transfer the bitmap used by the buttons.
+ *
+ * @param Input Pointer to the input structure.
+ *
+ * @return None
+ */
+static void ButtonInputSwap(button_input_t *Input)
+{
+    Input->Front ^= 1U;
+    Input->Complete = 0;
+    Input->Busy = 0;
+}
+
+/* ========================== Reference Backends ========================= */
+/**
+ * @brief Starts a read of a 74HC165 shift register chain.
+ *
+ * Pulses the parallel load input, then shifts the chain in MSB first, either
+ * through the bus receive routine or by bit-banging the clock.
+ *
+ * @param Input Pointer to the input structure.
+ * @param Data Buffer receiving the bitmap.
+ * @param Length Number of bytes to read.
+ * @return Status of the transfer start.
+ */
+static BTN_operate_status ButtonInputShiftStart(button_input_t *Input, uint8_t *Data, uint16_t Length)
+{
+    const button_input_shift_t *Shift = (const button_input_shift_t *)Input->Context;
+
+    ButtonInputWritePin(Shift->LatchPort, Shift->LatchPin, 0);
+    ButtonInputWritePin(Shift->LatchPort, Shift->LatchPin, 1);
+
+    if (Shift->Read != NULL)
+    {
+        if (Shift->Read(Shift->Bus, 0, 0, Data, Length) != BTN_OK)
+        {
+            return BTN_ERROR;
+        }
+        return Shift->Async ? BTN_OK : ButtonInputComplete(Input);
+    }
+
+    for (uint16_t Byte = 0; Byte < Length; Byte++)
+    {
+        uint8_t Value = 0;
+
+        for (uint8_t Bit = 8; Bit != 0U; Bit--)
+        {
+            Value = (uint8_t)((Value << 1) | ButtonInputReadPin(Shift->DataPort, Shift->DataPin));
+            ButtonInputWritePin(Shift->ClockPort, Shift->ClockPin, 1);
+            ButtonInputWritePin(Shift->ClockPort, Shift->ClockPin, 0);
+        }
+        Data[Byte] = Value;
+    }
+    return ButtonInputComplete(Input);
+}
+
+/**
+ * @brief Starts a read of the input port registers of an expander.
+ *
+ * @param Input Pointer to the input structure.
+ * @param Data Buffer receiving the bitmap.
+ * @param Length Number of bytes to read.
+ * @return Status of the transfer start.
+ */
+static BTN_operate_status ButtonInputExpanderStart(button_input_t *Input, uint8_t *Data, uint16_t Length)
+{
+    const button_input_expander_t *Expander = (const button_input_expander_t *)Input->Context;
+
+    if (Expander->Read(Expander->Bus, Expander->Address, Expander->Register, Data, Length) != BTN_OK)
+    {
+        return BTN_ERROR;
+    }
+    return Expander->Async ? BTN_OK : ButtonInputComplete(Input);
+}
+
+/**
+ * @brief Stops an asynchronous read of a 74HC165 shift register chain.
+ *
+ * @param Input Pointer to the input structure.
+ *
+ * @return None
+ */
+static void ButtonInputShiftCancel(button_input_t *Input)
+{
+    const button_input_shift_t *Shift = (const button_input_shift_t *)Input->Context;
+
+    if (Shift->Async && Shift->Abort != NULL)
+    {
+        Shift->Abort(Shift->Bus);
+    }
+}
+
+/**
+ * @brief Stops an asynchronous read of the input port registers of an expander.
+ *
+ * @param Input Pointer to the input structure.
+ *
+ * @return None
+ */
+static void ButtonInputExpanderCancel(button_input_t *Input)
+{
+    const button_input_expander_t *Expander = (const button_input_expander_t *)Input->Context;
+
+    if (Expander->Async && Expander->Abort != NULL)
+    {
+        Expander->Abort(Expander->Bus);
+    }
+}
+
+const button_input_backend_t ButtonInputShiftRegister = {ButtonInputShiftStart, ButtonInputShiftCancel};
+const button_input_backend_t ButtonInputExpander = {ButtonInputExpanderStart, ButtonInputExpanderCancel};
+
+/* ========================== Initialization Functions =========================
+ */
+/**
+ * @brief Initializes a bulk input.
+ *
+ * Both bitmaps are filled with the released level, so the buttons stay idle
+ * until the first transfer completes.
+ *
+ * @param Input Pointer to the input structure to initialize.
+ * @param Backend Backend operations.
+ * @param Context Backend specific context.
+ * @param BitsCount Number of input bits (1 to `BTN_INPUT_MAX_BITS`).
+ * @param Keys Array of buttons bound to the input.
+ * @param KeysCount Number of buttons.
+ * @param Logic `NON_REVERSE` if a pressed button reads 0, `REVERSE` if it
+ * reads 1.
+ * @return Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if an error occurs during initialization.
+ */
+BTN_operate_status ButtonInputInit(button_input_t *Input, const button_input_backend_t *Backend, void *Context,
+                                   uint16_t BitsCount, button_t *Keys, uint16_t KeysCount, ReverseLogicGpio_t Logic)
+{
+    if (Input == NULL || Backend == NULL || Backend->Start == NULL || Keys == NULL || BitsCount == 0U ||
+        BitsCount > BTN_INPUT_MAX_BITS)
+    {
+        return BTN_ERROR;
+    }
+
+    for (uint16_t i = 0; i < KeysCount; i++)
+    {
+        if (Keys[i].GpioPort != NULL || Keys[i].GpioPin >= BitsCount)
+        {
+            return BTN_ERROR;
+        }
+    }
+
+    Input->Backend = Backend;
+    Input->Context = Context;
+    Input->Keys = Keys;
+    Input->KeysCount = KeysCount;
+    Input->BitsCount = BitsCount;
+    Input->Logic = Logic;
+    Input->Front = 0;
+    Input->Busy = 0;
+    Input->Complete = 0;
+    memset(Input->Data, (Logic == REVERSE) ? 0x00 : 0xFF, sizeof(Input->Data));
+    return BTN_OK;
+}
+
+/* =================================== Polling
+ * ================================== */
+/**
+ * @brief Polls a bulk input and runs the state machines of its buttons.
+ *
+ * @param Input Pointer to the input structure.
+ * @return Status of the task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if the transfer could not be started or the input is
+ *         invalid.
+ */
+BTN_operate_status ButtonInputTask(button_input_t *Input)
+{
+    return ButtonInputTaskAt(Input, ButtonGetTick());
+}
+
+/**
+ * @brief Polls a bulk input at an explicitly given tick.
+ *
+ * Actions performed:
+ * - Takes over a transfer completed since the last poll.
+ * - Stops a transfer still in progress `BTN_INPUT_TIMEOUT` ticks after its
+ * start through the backend's `Cancel`, e.g. after a bus error or a missed
+ * completion interrupt, and abandons it.
+ * - If no transfer is in progress, starts the next one into the back bitmap;
+ * a blocking backend completes it right away and it is used in this poll.
+ * - Runs every button on its bit of the completed bitmap.
+ *
+ * @param Input Pointer to the input structure.
+ * @param Now Current tick.
+ * @return Status of the task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if the transfer could not be started or the input is
+ *         invalid.
+ */
+BTN_operate_status ButtonInputTaskAt(button_input_t *Input, BTN_TIME_t Now)
+{
+    BTN_operate_status Status = BTN_OK;
+    const uint8_t *Data;
+
+    if (Input == NULL || Input->Backend == NULL || Input->Keys == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    if (Input->Complete)
+    {
+        ButtonInputSwap(Input);
+    }
+#if BTN_INPUT_TIMEOUT
+    else if (Input->Busy && (BTN_TIME_t)(Now - Input->StartTick) >= BTN_INPUT_TIMEOUT)
+    {
+        /* Stop the transfer before its buffer is reused; a completion it still reports is dropped. */
+        if (Input->Backend->Cancel != NULL)
+        {
+            Input->Backend->Cancel(Input);
+        }
+        (void)ButtonInputAbort(Input);
+    }
+#endif
+    if (!Input->Busy)
+    {
+        Input->Busy = 1;
+#if BTN_INPUT_TIMEOUT
+        Input->StartTick = Now;
+#endif
+        if (Input->Backend->Start(Input, Input->Data[Input->Front ^ 1U], (uint16_t)((Input->BitsCount + 7U) / 8U)) !=
+            BTN_OK)
+        {
+            Input->Busy = 0;
+            Status = BTN_ERROR;
+        }
+        else if (Input->Complete)
+        {
+            ButtonInputSwap(Input);
+        }
+    }
+
+    Data = Input->Data[Input->Front];
+    for (uint16_t i = 0; i < Input->KeysCount; i++)
+    {
+        button_t *Key = &Input->Keys[i];
+        uint8_t Level = (uint8_t)((Data[Key->GpioPin >> 3] >> (Key->GpioPin & 7U)) & 1U);
+
+        ButtonFeedInput(Key, (Input->Logic == REVERSE) ? Level : (uint8_t)!Level, Now);
+    }
+    return Status;
+}
+
+/**
+ * @brief Reports the completion of a backend transfer.
+ *
+ * @param Input Pointer to the input structure.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if no transfer was in progress.
+ */
+BTN_operate_status ButtonInputComplete(button_input_t *Input)
+{
+    if (Input == NULL || !Input->Busy)
+    {
+        return BTN_ERROR;
+    }
+
+    Input->Complete = 1;
+    return BTN_OK;
+}
+
+/**
+ * @brief Abandons the backend transfer in progress.
+ *
+ * A completion reported before the abort is dropped as well: its bitmap may
+ * belong to the failed transfer.
+ *
+ * @param Input Pointer to the input structure.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonInputAbort(button_input_t *Input)
+{
+    if (Input == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    Input->Complete = 0;
+    Input->Busy = 0;
+    return BTN_OK;
+}
+
+#ifdef HAL_TO_DEFINE
+#define USE_HAL_DRIVER
+#endif
+
+#endif
@@ -0,0 +1,229 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+
+#ifndef INC_BUTTON_INPUT_H_
+#define INC_BUTTON_INPUT_H_
+
+#include "button.h"
+
+#if BTN_INPUT
+
+/**
+ * @brief Number of bytes of an input bitmap.
+ */
+#define BTN_INPUT_MAX_BYTES ((BTN_INPUT_MAX_BITS + 7) / 8)
+
+typedef struct button_input button_input_t;
+
+/**
+ * @brief Operations of a bulk input backend.
+ *
+ * `Start` begins one transfer of the whole input bitmap into `Data`
+ * (`(BitsCount + 7) / 8` bytes, bit `i` in `Data[i / 8]` bit `i % 8`). When the
+ * data are in place, `ButtonInputComplete()` must be called: right away by a
+ * blocking backend, or from the transfer complete interrupt by a non-blocking
+ * (DMA) one. Returning `BTN_ERROR` aborts the transfer. A non-blocking backend
+ * that fails after the start calls `ButtonInputAbort()` instead.
+ *
+ * A transfer that does not report at all is abandoned after
+ * `BTN_INPUT_TIMEOUT`, and the next one is started into the same buffer.
+ * `Cancel` is called first and must stop the transfer, so it can neither write
+ * `Data` any more nor call `ButtonInputComplete()` later. A non-blocking
+ * backend without `Cancel` (NULL) must stop its own transfer before
+ * `BTN_INPUT_TIMEOUT` ticks have passed; otherwise the abandoned transfer may
+ * overwrite the next one and its late completion is taken for the next one's.
+ */
+typedef struct
+{
+    BTN_operate_status (*Start)(button_input_t *Input, uint8_t *Data, uint16_t Length);
+    void (*Cancel)(button_input_t *Input); /**< Stops the transfer in progress, NULL for blocking backends. */
+} button_input_backend_t;
+
+/**
+ * @brief Bulk input: a bitmap filled by a backend and the buttons reading it.
+ *
+ * The bitmap is double-buffered: the buttons are evaluated on the last
+ * completed transfer while the next one is in progress.
+ */
+struct button_input
+{
+    const button_input_backend_t *Backend;  /**< Backend operations. */
+    void *Context;                          /**< Backend specific context (bus, pins, address). */
+    button_t *Keys;                         /**< Buttons bound to bits of the bitmap (`ButtonInitKeyBit()`). */
+    uint16_t KeysCount;                     /**< Number of buttons. */
+    uint16_t BitsCount;                     /**< Number of valid bits of the bitmap. */
+    uint8_t Data[2][BTN_INPUT_MAX_BYTES];   /**< Completed and in-progress bitmaps. */
+    uint8_t Front;                          /**< Index of the completed bitmap in `Data`. */
+    volatile uint8_t Busy;                  /**< Non-zero while a transfer is in progress. */
+#if BTN_INPUT_TIMEOUT
+    BTN_TIME_t StartTick;                   /**< Tick at which the transfer in progress was started. */
+#endif
+    volatile uint8_t Complete;              /**< Set by `ButtonInputComplete()`. */
+    ReverseLogicGpio_t Logic;               /**< `NON_REVERSE`: a bit reads 0 when pressed. */
+};
+
+/**
+ * @brief Reads `Length` bytes from a bus device.
+ *
+ * Used by the reference backends to stay independent of the bus driver. For
+ * I2C/SPI expanders `Address` and `Register` select the device and its input
+ * register; for shift registers both are 0. A blocking implementation returns
+ * after the data are in `Data`; a non-blocking one returns once the transfer is
+ * started.
+ */
+typedef BTN_operate_status (*button_bus_read_t)(void *Bus, uint8_t Address, uint8_t Register, uint8_t *Data,
+                                                uint16_t Length);
+
+/**
+ * @brief Stops a non-blocking transfer started by a `button_bus_read_t`.
+ *
+ * Called by the reference backends when a transfer is abandoned after
+ * `BTN_INPUT_TIMEOUT` (e.g. `HAL_SPI_Abort()`, or `HAL_DMA_Abort()` and a
+ * reset of the peripheral).
+ * When it returns, the transfer must no longer write its buffer or report its
+ * completion.
+ */
+typedef void (*button_bus_abort_t)(void *Bus);
+
+/**
+ * @brief Context of the 74HC165 shift register chain backend.
+ *
+ * Before each transfer the parallel load input (`LatchPort`/`LatchPin`, active
+ * low) is pulsed. The chain is then read either with `Read` (e.g. a SPI receive,
+ * MSB first, optionally by DMA) or, if `Read` is NULL, bit-banged on
+ * `ClockPort`/`ClockPin` and `DataPort`/`DataPin`. Bit `8 * n + k` of the
+ * bitmap is input `Dk` of the `n`-th register counted from the MCU.
+ */
+typedef struct
+{
+    BTN_GPIO_PORT_T *LatchPort; /**< Port of the parallel load (PL) output. */
+    BTN_GPIO_PIN_T LatchPin;    /**< Pin of the parallel load (PL) output. */
+    BTN_GPIO_PORT_T *ClockPort; /**< Port of the clock (CP) output, bit-bang only. */
+    BTN_GPIO_PIN_T ClockPin;    /**< Pin of the clock (CP) output, bit-bang only. */
+    BTN_GPIO_PORT_T *DataPort;  /**< Port of the serial data (QH) input, bit-bang only. */
+    BTN_GPIO_PIN_T DataPin;     /**< Pin of the serial data (QH) input, bit-bang only. */
+    button_bus_read_t Read;     /**< Bus receive routine, or NULL to bit-bang. */
+    void *Bus;                  /**< Bus handle passed to `Read`. */
+    uint8_t Async;              /**< Non-zero if `Read` completes in an interrupt. */
+    button_bus_abort_t Abort;   /**< Stops an asynchronous `Read`, NULL if not needed. */
+} button_input_shift_t;
+
+/**
+ * @brief Context of the I2C/SPI port expander backend.
+ *
+ * Reads the input port registers of an expander with a single register read,
+ * e.g. MCP23017 `GPIOA`/`GPIOB` (`Register` 0x12, 16 bits) or PCA9555 input
+ * port 0/1 (`Register` 0x00, 16 bits).
+ */
+typedef struct
+{
+    button_bus_read_t Read;   /**< Bus register read routine. */
+    void *Bus;                /**< Bus handle passed to `Read`. */
+    uint8_t Address;          /**< Device address. */
+    uint8_t Register;         /**< First input port register. */
+    uint8_t Async;            /**< Non-zero if `Read` completes in an interrupt. */
+    button_bus_abort_t Abort; /**< Stops an asynchronous `Read`, NULL if not needed. */
+} button_input_expander_t;
+
+/**
+ * @brief Reference backend for 74HC165 shift register chains
+ * (`button_input_shift_t` context).
+ */
+extern const button_input_backend_t ButtonInputShiftRegister;
+
+/**
+ * @brief Reference backend for I2C/SPI port expanders
+ * (`button_input_expander_t` context).
+ */
+extern const button_input_backend_t ButtonInputExpander;
+
+/**
+ * @brief Initializes a bulk input.
+ *
+ * The buttons must be initialized with `ButtonInitKeyBit()` with bit indexes
+ * below `BitsCount`. Until the first transfer completes, all bits read as
+ * released.
+ *
+ * @param Input Pointer to the input structure to initialize.
+ * @param Backend Backend operations (e.g. `&ButtonInputShiftRegister`).
+ * @param Context Backend specific context.
+ * @param BitsCount Number of input bits (1 to `BTN_INPUT_MAX_BITS`).
+ * @param Keys Array of buttons bound to the input.
+ * @param KeysCount Number of buttons.
+ * @param Logic `NON_REVERSE` if a pressed button reads 0, `REVERSE` if it
+ * reads 1.
+ * @retval Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if an error occurs during initialization.
+ */
+BTN_operate_status ButtonInputInit(button_input_t *Input, const button_input_backend_t *Backend, void *Context,
+                                   uint16_t BitsCount, button_t *Keys, uint16_t KeysCount, ReverseLogicGpio_t Logic);
+
+/**
+ * @brief Polls a bulk input and runs the state machines of its buttons.
+ *
+ * Starts a new transfer when none is in progress and evaluates all buttons on
+ * the last completed bitmap, so every poll costs at most one bus transfer. A
+ * transfer still in progress `BTN_INPUT_TIMEOUT` ticks after its start is
+ * stopped through the backend's `Cancel` and the next one is started.
+ *
+ * @param Input Pointer to the input structure.
+ * @retval Status of the task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if the transfer could not be started or the input is
+ *         invalid.
+ */
+BTN_operate_status ButtonInputTask(button_input_t *Input);
+
+/**
+ * @brief Polls a bulk input at an explicitly given tick.
+ *
+ * Same as `ButtonInputTask()`, but all timing decisions use `Now`.
+ *
+ * @param Input Pointer to the input structure.
+ * @param Now Current tick.
+ * @retval Status of the task:
+ *         - `BTN_OK` if the task executed successfully.
+ *         - `BTN_ERROR` if the transfer could not be started or the input is
+ *         invalid.
+ */
+BTN_operate_status ButtonInputTaskAt(button_input_t *Input, BTN_TIME_t Now);
+
+/**
+ * @brief Reports the completion of a backend transfer.
+ *
+ * Safe to call from an interrupt handler (e.g. `HAL_SPI_RxCpltCallback`,
+ * `HAL_I2C_MemRxCpltCallback`). The new bitmap is used from the next poll on.
+ *
+ * @param Input Pointer to the input structure.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonInputComplete(button_input_t *Input);
+
+/**
+ * @brief Abandons the backend transfer in progress.
+ *
+ * Safe to call from an interrupt handler (e.g. `HAL_SPI_ErrorCallback`,
+ * `HAL_I2C_ErrorCallback`). The buttons keep the last completed bitmap and the
+ * next poll starts a new transfer. The backend must have stopped the failed
+ * transfer, since a completion reported later would be taken for the new one.
+ *
+ * @param Input Pointer to the input structure.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonInputAbort(button_input_t *Input);
+
+#endif
+
+#endif /* INC_BUTTON_INPUT_H_ */
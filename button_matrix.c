@@ -0,0 +1,333 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+#include "button_matrix.h"
+#include <stddef.h>
+
+#if BTN_MATRIX
+
+#if BTN_FORCE_NON_HAL
+#undef USE_HAL_DRIVER
+#define HAL_TO_DEFINE
+#endif
+
+/* ========================== Helper Functions ========================= */
+/**
+ * @brief Moves the driven row of the matrix from `Prev` to `Next`.
+ *
+ * The previous row is returned to its inactive level and the next one is driven
+ * to its active level. Without the HAL both changes are done with a single
+ * `BSRR` write when the two rows share a port, which keeps a full scan at one
+ * port write per row.
+ *
+ * @param Matrix Pointer to the matrix structure.
+ * @param Prev Row driven so far, or `BTN_MATRIX_NO_ROW`.
+ * @param Next Row to drive, or `BTN_MATRIX_NO_ROW`.
+ *
+ * @return None
+ */
+static void ButtonMatrixSelectRow(button_matrix_t *Matrix, uint8_t Prev, uint8_t Next)
+{
+#ifdef USE_HAL_DRIVER
+    GPIO_PinState Active = (Matrix->Logic == REVERSE) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+    GPIO_PinState Idle = (Matrix->Logic == REVERSE) ? GPIO_PIN_RESET : GPIO_PIN_SET;
+
+    if (Prev != BTN_MATRIX_NO_ROW)
+    {
+        HAL_GPIO_WritePin(Matrix->RowPorts[Prev], Matrix->RowPins[Prev], Idle);
+    }
+    if (Next != BTN_MATRIX_NO_ROW)
+    {
+        HAL_GPIO_WritePin(Matrix->RowPorts[Next], Matrix->RowPins[Next], Active);
+    }
+#else
+    uint32_t PrevBits = 0;
+    uint32_t NextBits = 0;
+
+    /* BSRR: the low half sets pins, the high half resets them. */
+    if (Prev != BTN_MATRIX_NO_ROW)
+    {
+        PrevBits = (Matrix->Logic == REVERSE) ? ((uint32_t)Matrix->RowPins[Prev] << 16)
+                                              : (uint32_t)Matrix->RowPins[Prev];
+    }
+    if (Next != BTN_MATRIX_NO_ROW)
+    {
+        NextBits = (Matrix->Logic == REVERSE) ? (uint32_t)Matrix->RowPins[Next]
+                                              : ((uint32_t)Matrix->RowPins[Next] << 16);
+    }
+
+    if (Prev != BTN_MATRIX_NO_ROW && Next != BTN_MATRIX_NO_ROW && Matrix->RowPorts[Prev] == Matrix->RowPorts[Next])
+    {
+        Matrix->RowPorts[Next]->BSRR = PrevBits | NextBits;
+        return;
+    }
+    if (Prev != BTN_MATRIX_NO_ROW)
+    {
+        Matrix->RowPorts[Prev]->BSRR = PrevBits;
+    }
+    if (Next != BTN_MATRIX_NO_ROW)
+    {
+        Matrix->RowPorts[Next]->BSRR = NextBits;
+    }
+#endif
+}
+
+/**
+ * @brief Converts a column port snapshot into the key bitmap of one row.
+ *
+ * @param Matrix Pointer to the matrix structure.
+ * @param PortState Input levels of the column port.
+ * @return Bitmap of the pressed keys of the row (bit c = column c).
+ */
+static uint16_t ButtonMatrixColumns(const button_matrix_t *Matrix, BTN_GPIO_PIN_T PortState)
+{
+    uint16_t Bits = 0;
+
+    if (Matrix->Logic != REVERSE)
+    {
+        PortState = (BTN_GPIO_PIN_T)~PortState;
+    }
+    for (uint8_t Col = 0; Col < Matrix->Cols; Col++)
+    {
+        if ((PortState & Matrix->ColPins[Col]) != 0U)
+        {
+            Bits |= (uint16_t)(1U << Col);
+        }
+    }
+    return Bits;
+}
+
+/**
+ * @brief Freezes the keys that cannot be told apart from ghost keys.
+ *
+ * Two rows sharing two or more pressed columns form a rectangle whose corners
+ * are ambiguous. Those keys keep the state of the previous scan.
+ *
+ * @param Matrix Pointer to the matrix structure.
+ * @param Scan Raw key bitmap of the current scan; updated in place.
+ *
+ * @return None
+ */
+static void ButtonMatrixMaskGhosts(const button_matrix_t *Matrix, uint16_t *Scan)
+{
+    uint16_t Ghost[BTN_MATRIX_MAX_ROWS] = {0};
+
+    for (uint8_t First = 0; First < Matrix->Rows; First++)
+    {
+        for (uint8_t Second = (uint8_t)(First + 1U); Second < Matrix->Rows; Second++)
+        {
+            uint16_t Common = Scan[First] & Scan[Second];
+
+            /* More than one bit set. */
+            if ((Common & (uint16_t)(Common - 1U)) != 0U)
+            {
+                Ghost[First] |= Common;
+                Ghost[Second] |= Common;
+            }
+        }
+    }
+    for (uint8_t Row = 0; Row < Matrix->Rows; Row++)
+    {
+        Scan[Row] = (uint16_t)((Scan[Row] & ~Ghost[Row]) | (Matrix->State[Row] & Ghost[Row]));
+    }
+}
+
+/* ========================== Initialization Functions =========================
+ */
+/**
+ * @brief Initializes a keypad matrix scanner and its keys.
+ *
+ * Every key is initialized with `ButtonInitKeyConfig()` on the column it is
+ * read from, using the shared configuration. Keys are numbered
+ * `FirstNumber + row * Cols + col`. All row outputs are set to their inactive
+ * level.
+ *
+ * @param Matrix Pointer to the matrix structure to initialize.
+ * @param Keys Array of `Rows * Cols` buttons, row-major.
+ * @param RowPorts GPIO port of every row output.
+ * @param RowPins GPIO pin of every row output.
+ * @param Rows Number of rows (1 to `BTN_MATRIX_MAX_ROWS`).
+ * @param ColPort GPIO port of all column inputs.
+ * @param ColPins GPIO pin of every column input.
+ * @param Cols Number of columns (1 to `BTN_MATRIX_MAX_COLS`).
+ * @param Config Timing and callback configuration shared by all keys.
+ * @param FirstNumber Identifier of the first key passed to callbacks.
+ * @return Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if an error occurs during initialization.
+ */
+BTN_operate_status ButtonMatrixInit(button_matrix_t *Matrix, button_t *Keys, BTN_GPIO_PORT_T *const *RowPorts,
+                                    const BTN_GPIO_PIN_T *RowPins, uint8_t Rows, BTN_GPIO_PORT_T *ColPort,
+                                    const BTN_GPIO_PIN_T *ColPins, uint8_t Cols, const button_config_t *Config,
+                                    uint16_t FirstNumber)
+{
+    if (Matrix == NULL || Keys == NULL || RowPorts == NULL || RowPins == NULL || ColPort == NULL ||
+        ColPins == NULL || Config == NULL || Rows == 0U || Rows > BTN_MATRIX_MAX_ROWS || Cols == 0U ||
+        Cols > BTN_MATRIX_MAX_COLS)
+    {
+        return BTN_ERROR;
+    }
+
+    Matrix->Keys = Keys;
+    Matrix->Rows = Rows;
+    Matrix->Cols = Cols;
+    Matrix->ColPort = ColPort;
+    Matrix->Logic = Config->ReverseLogic;
+    Matrix->SettleCycles = 0;
+    Matrix->GhostMask = 0;
+    Matrix->ActiveRow = BTN_MATRIX_NO_ROW;
+
+    for (uint8_t Col = 0; Col < Cols; Col++)
+    {
+        Matrix->ColPins[Col] = ColPins[Col];
+    }
+    for (uint8_t Row = 0; Row < Rows; Row++)
+    {
+        if (RowPorts[Row] == NULL)
+        {
+            return BTN_ERROR;
+        }
+        Matrix->RowPorts[Row] = RowPorts[Row];
+        Matrix->RowPins[Row] = RowPins[Row];
+        Matrix->State[Row] = 0;
+
+        for (uint8_t Col = 0; Col < Cols; Col++)
+        {
+            uint16_t Index = (uint16_t)(Row * Cols + Col);
+
+            if (ButtonInitKeyConfig(&Keys[Index], ColPort, ColPins[Col], Config,
+                                    (uint16_t)(FirstNumber + Index)) != BTN_OK)
+            {
+                return BTN_ERROR;
+            }
+        }
+        ButtonMatrixSelectRow(Matrix, Row, BTN_MATRIX_NO_ROW);
+    }
+    return BTN_OK;
+}
+
+/* =================================== Scanning
+ * ================================== */
+/**
+ * @brief Scans the matrix once and runs the state machines of all keys.
+ *
+ * @param Matrix Pointer to the matrix structure.
+ * @return Status of the scan:
+ *         - `BTN_OK` if the scan executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonMatrixTask(button_matrix_t *Matrix)
+{
+    return ButtonMatrixTaskAt(Matrix, ButtonGetTick());
+}
+
+/**
+ * @brief Scans the matrix once at an explicitly given tick.
+ *
+ * Actions performed:
+ * - Drives every row in turn (the previous row is released in the same write
+ * when possible) and, after the settle delay, reads the column port once.
+ * - Converts each snapshot into the key bitmap of the row and masks ghost keys
+ * if enabled.
+ * - Runs the state machine of every key on its bit of the bitmap.
+ *
+ * The last row is left driven until the next scan, so a steady-state scan
+ * costs exactly one port write and one port read per row.
+ *
+ * @param Matrix Pointer to the matrix structure.
+ * @param Now Current tick.
+ * @return Status of the scan:
+ *         - `BTN_OK` if the scan executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonMatrixTaskAt(button_matrix_t *Matrix, BTN_TIME_t Now)
+{
+    uint16_t Scan[BTN_MATRIX_MAX_ROWS];
+
+    if (Matrix == NULL || Matrix->Keys == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    for (uint8_t Row = 0; Row < Matrix->Rows; Row++)
+    {
+        ButtonMatrixSelectRow(Matrix, Matrix->ActiveRow, Row);
+        Matrix->ActiveRow = Row;
+        if (Matrix->SettleCycles != 0U)
+        {
+            BTN_MATRIX_SETTLE_DELAY(Matrix->SettleCycles);
+        }
+        Scan[Row] = ButtonMatrixColumns(Matrix, (BTN_GPIO_PIN_T)Matrix->ColPort->IDR);
+    }
+
+    if (Matrix->GhostMask)
+    {
+        ButtonMatrixMaskGhosts(Matrix, Scan);
+    }
+
+    for (uint8_t Row = 0; Row < Matrix->Rows; Row++)
+    {
+        button_t *Key = &Matrix->Keys[Row * Matrix->Cols];
+
+        Matrix->State[Row] = Scan[Row];
+        for (uint8_t Col = 0; Col < Matrix->Cols; Col++)
+        {
+            ButtonFeedInput(&Key[Col], (uint8_t)((Scan[Row] >> Col) & 1U), Now);
+        }
+    }
+    return BTN_OK;
+}
+
+/* ========================== Configuration Functions =========================
+ */
+/**
+ * @brief Sets the settle delay between driving a row and reading the columns.
+ *
+ * @param Matrix Pointer to the matrix structure.
+ * @param Cycles Settle delay passed to `BTN_MATRIX_SETTLE_DELAY()`.
+ * @return Status of the configuration:
+ *         - `BTN_OK` if the configuration was successful.
+ *         - `BTN_ERROR` if there was an error during configuration.
+ */
+BTN_operate_status ButtonMatrixSetSettle(button_matrix_t *Matrix, uint16_t Cycles)
+{
+    if (Matrix == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    Matrix->SettleCycles = Cycles;
+    return BTN_OK;
+}
+
+/**
+ * @brief Enables or disables ghost key masking.
+ *
+ * @param Matrix Pointer to the matrix structure.
+ * @param Enable 1 to mask ghost keys, 0 to report the raw scan.
+ * @return Status of the configuration:
+ *         - `BTN_OK` if the configuration was successful.
+ *         - `BTN_ERROR` if there was an error during configuration.
+ */
+BTN_operate_status ButtonMatrixSetGhostMask(button_matrix_t *Matrix, uint8_t Enable)
+{
+    if (Matrix == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    Matrix->GhostMask = Enable;
+    return BTN_OK;
+}
+
+#ifdef HAL_TO_DEFINE
+#define USE_HAL_DRIVER
+#endif
+
+#endif
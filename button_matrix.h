@@ -0,0 +1,140 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+
+#ifndef INC_BUTTON_MATRIX_H_
+#define INC_BUTTON_MATRIX_H_
+
+#include "button.h"
+
+#if BTN_MATRIX
+
+#if BTN_MATRIX_MAX_COLS > 16
+#error "BTN_MATRIX_MAX_COLS: at most 16 columns are supported"
+#endif
+
+/**
+ * @brief Value of `ActiveRow` when no row of the matrix is driven.
+ */
+#define BTN_MATRIX_NO_ROW 0xFFU
+
+/**
+ * @brief Structure of a keypad matrix scanner.
+ *
+ * The rows are driven one at a time; for each row all columns are read with a
+ * single read of the column port. The resulting key bitmap is fed into the
+ * regular button state machine of every key, so the keys provide the same
+ * debounce, long press, repeat and multiple click handling as single buttons.
+ *
+ * With `NON_REVERSE` logic (the usual wiring with column pull-ups) the active
+ * row is driven low and a pressed key reads low on its column; with `REVERSE`
+ * logic the active row is driven high and a pressed key reads high.
+ */
+typedef struct
+{
+    button_t *Keys;                                   /**< Rows * Cols keys, row-major (key = row * Cols + col). */
+    BTN_GPIO_PORT_T *RowPorts[BTN_MATRIX_MAX_ROWS];   /**< GPIO port of every row output. */
+    BTN_GPIO_PIN_T RowPins[BTN_MATRIX_MAX_ROWS];      /**< GPIO pin of every row output. */
+    BTN_GPIO_PORT_T *ColPort;                         /**< GPIO port shared by all column inputs. */
+    BTN_GPIO_PIN_T ColPins[BTN_MATRIX_MAX_COLS];      /**< GPIO pin of every column input. */
+    uint16_t State[BTN_MATRIX_MAX_ROWS];              /**< Key bitmap of the last scan (bit c = column c). */
+    uint16_t SettleCycles;                            /**< Settle delay between driving a row and reading. */
+    uint8_t Rows;                                     /**< Number of rows. */
+    uint8_t Cols;                                     /**< Number of columns. */
+    uint8_t ActiveRow;                                /**< Row currently driven, or `BTN_MATRIX_NO_ROW`. */
+    uint8_t GhostMask;                                /**< Non-zero if ghost keys are masked. */
+    ReverseLogicGpio_t Logic;                         /**< Polarity of rows and columns. */
+} button_matrix_t;
+
+/**
+ * @brief Initializes a keypad matrix scanner and its keys.
+ *
+ * Every key is initialized with `ButtonInitKeyConfig()` using the shared
+ * configuration (with `BTN_SHARED_CONFIG` all keys reference it, otherwise each
+ * key gets a copy). Keys are numbered `FirstNumber + row * Cols + col`. The
+ * row outputs are set to their inactive level. The polarity of rows and columns
+ * is taken from `Config->ReverseLogic`.
+ *
+ * @param Matrix Pointer to the matrix structure to initialize.
+ * @param Keys Array of `Rows * Cols` buttons, row-major.
+ * @param RowPorts GPIO port of every row output.
+ * @param RowPins GPIO pin of every row output.
+ * @param Rows Number of rows (1 to `BTN_MATRIX_MAX_ROWS`).
+ * @param ColPort GPIO port of all column inputs.
+ * @param ColPins GPIO pin of every column input.
+ * @param Cols Number of columns (1 to `BTN_MATRIX_MAX_COLS`).
+ * @param Config Timing and callback configuration shared by all keys.
+ * @param FirstNumber Identifier of the first key passed to callbacks.
+ * @retval Status of the initialization:
+ *         - `BTN_OK` if initialization is successful.
+ *         - `BTN_ERROR` if an error occurs during initialization.
+ */
+BTN_operate_status ButtonMatrixInit(button_matrix_t *Matrix, button_t *Keys, BTN_GPIO_PORT_T *const *RowPorts,
+                                    const BTN_GPIO_PIN_T *RowPins, uint8_t Rows, BTN_GPIO_PORT_T *ColPort,
+                                    const BTN_GPIO_PIN_T *ColPins, uint8_t Cols, const button_config_t *Config,
+                                    uint16_t FirstNumber);
+
+/**
+ * @brief Scans the matrix once and runs the state machines of all keys.
+ *
+ * Costs one row write and one column port read per row.
+ *
+ * @param Matrix Pointer to the matrix structure.
+ * @retval Status of the scan:
+ *         - `BTN_OK` if the scan executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonMatrixTask(button_matrix_t *Matrix);
+
+/**
+ * @brief Scans the matrix once at an explicitly given tick.
+ *
+ * Same as `ButtonMatrixTask()`, but all timing decisions use `Now`.
+ *
+ * @param Matrix Pointer to the matrix structure.
+ * @param Now Current tick.
+ * @retval Status of the scan:
+ *         - `BTN_OK` if the scan executed successfully.
+ *         - `BTN_ERROR` if there was an error during execution.
+ */
+BTN_operate_status ButtonMatrixTaskAt(button_matrix_t *Matrix, BTN_TIME_t Now);
+
+/**
+ * @brief Sets the settle delay between driving a row and reading the columns.
+ *
+ * The delay is executed with `BTN_MATRIX_SETTLE_DELAY()`; 0 reads the columns
+ * right after the row write.
+ *
+ * @param Matrix Pointer to the matrix structure.
+ * @param Cycles Settle delay passed to `BTN_MATRIX_SETTLE_DELAY()`.
+ * @retval Status of the configuration:
+ *         - `BTN_OK` if the configuration was successful.
+ *         - `BTN_ERROR` if there was an error during configuration.
+ */
+BTN_operate_status ButtonMatrixSetSettle(button_matrix_t *Matrix, uint16_t Cycles);
+
+/**
+ * @brief Enables or disables ghost key masking.
+ *
+ * In a matrix without diodes, three pressed keys on the corners of a rectangle
+ * make the fourth corner read as pressed. When masking is enabled, every key on
+ * the corners of such a rectangle (two rows sharing two or more pressed
+ * columns) keeps its previous state until the ambiguity is gone.
+ *
+ * @param Matrix Pointer to the matrix structure.
+ * @param Enable 1 to mask ghost keys, 0 to report the raw scan.
+ * @retval Status of the configuration:
+ *         - `BTN_OK` if the configuration was successful.
+ *         - `BTN_ERROR` if there was an error during configuration.
+ */
+BTN_operate_status ButtonMatrixSetGhostMask(button_matrix_t *Matrix, uint8_t Enable);
+
+#endif
+
+#endif /* INC_BUTTON_MATRIX_H_ */
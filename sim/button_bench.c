@@ -0,0 +1,398 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+
+/*
+ * Benchmark of the button state machine.
+ *
+ * Replays deterministic input traces (bouncy presses, long holds with repeat,
+ * click bursts) and reports the cost of one state machine step:
+ * - per state, for a single button driven by `ButtonTaskAt()`;
+ * - per button, for 1, 16, 64 and 256 buttons driven by `ButtonTaskAt()` and,
+ * where the buttons fit into a group, by `ButtonGroupTaskAt()`.
+ *
+ * On the host the unit is nanoseconds (CLOCK_MONOTONIC). On a Cortex-M target
+ * built with `BTN_BENCH_DWT` the unit is core cycles from `DWT->CYCCNT`; the
+ * simulated ports are then plain RAM structures of the device's `GPIO_TypeDef`
+ * (`BTN_SIM_NO_GPIO_MOCK`) and `printf` has to be retargeted (SWO,
+ * semihosting, UART).
+ */
+
+#if !defined(BTN_BENCH_DWT) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "button_sim.h"
+#include <stdio.h>
+
+#ifdef BTN_BENCH_DWT
+#define BENCH_DEMCR (*(volatile uint32_t *)0xE000EDFCU)
+#define BENCH_DWT_CTRL (*(volatile uint32_t *)0xE0001000U)
+#define BENCH_DWT_CYCCNT (*(volatile uint32_t *)0xE0001004U)
+#define BENCH_UNIT "cycles"
+typedef uint32_t bench_time_t;
+#else
+#include <time.h>
+#define BENCH_UNIT "ns"
+typedef uint64_t bench_time_t;
+#endif
+
+#define BENCH_MAX_KEYS 256
+#define BENCH_PINS_PER_PORT 16
+#define BENCH_TRACE_RECORDS 512
+#define BENCH_TRACE_TICKS 6000
+
+/**
+ * @brief State of one benchmark run, passed to the replay step routines.
+ */
+typedef struct
+{
+    button_t *Keys;                          /**< Buttons under test. */
+    uint16_t KeysCount;                      /**< Number of buttons. */
+    uint8_t PortsCount;                      /**< Number of simulated ports used. */
+#if BTN_GROUP
+    button_group_t *Group;                   /**< Group of the buttons, if they fit. */
+#endif
+    bench_time_t Overhead;                   /**< Cost of an empty measurement. */
+    bench_time_t Total;                      /**< Accumulated measured time. */
+    uint32_t Calls;                          /**< Number of measured steps. */
+    bench_time_t StateTime[8];               /**< Accumulated time per state. */
+    uint32_t StateCalls[8];                  /**< Number of steps per state. */
+} bench_run_t;
+
+static button_t BenchKeys[BENCH_MAX_KEYS];
+static button_config_t BenchConfig;
+#if BTN_GROUP
+static button_group_t BenchGroup;
+#endif
+static button_sim_record_t BenchRecords[BENCH_TRACE_RECORDS];
+static volatile uint32_t BenchEvents;
+
+/* ========================== Time Measurement ========================= */
+/**
+ * @brief Starts the time source of the benchmark.
+ *
+ * @return None
+ */
+static void BenchTimerInit(void)
+{
+#ifdef BTN_BENCH_DWT
+    BENCH_DEMCR |= (1UL << 24);
+    BENCH_DWT_CYCCNT = 0;
+    BENCH_DWT_CTRL |= 1UL;
+#endif
+}
+
+/**
+ * @brief Reads the time source of the benchmark.
+ *
+ * @return Current time in `BENCH_UNIT`.
+ */
+static bench_time_t BenchNow(void)
+{
+#ifdef BTN_BENCH_DWT
+    return BENCH_DWT_CYCCNT;
+#else
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+    return (bench_time_t)Time.tv_sec * 1000000000U + (bench_time_t)Time.tv_nsec;
+#endif
+}
+
+/**
+ * @brief Measures the cost of an empty measurement.
+ *
+ * @return Minimum time between two consecutive `BenchNow()` calls.
+ */
+static bench_time_t BenchOverhead(void)
+{
+    bench_time_t Min = (bench_time_t)~(bench_time_t)0;
+
+    for (uint16_t i = 0; i < 1000; i++)
+    {
+        bench_time_t Start = BenchNow();
+        bench_time_t Time = (bench_time_t)(BenchNow() - Start);
+
+        if (Time < Min)
+        {
+            Min = Time;
+        }
+    }
+    return Min;
+}
+
+/* ========================== Setup ========================= */
+/**
+ * @brief Counts a delivered event.
+ */
+#if BTN_EVENT_HANDLER
+static void BenchHandler(uint16_t Number, button_event_t Event, const button_event_info_t *Info)
+{
+    (void)Number;
+    (void)Event;
+    (void)Info;
+    BenchEvents++;
+}
+#else
+static void BenchCallback(uint16_t Number)
+{
+    (void)Number;
+    BenchEvents++;
+}
+#endif
+
+/**
+ * @brief Fills the benchmark configuration with all enabled features active.
+ *
+ * @return None
+ */
+static void BenchConfigInit(void)
+{
+    ButtonConfigInit(&BenchConfig, 20, 500, 100, NON_REVERSE);
+#if BTN_MULTIPLE_CLICK
+    BenchConfig.MultipleClickMode = BTN_MULTIPLE_CLICK_NORMAL_MODE;
+    BenchConfig.TimerBetweenClick = 300;
+#endif
+#if BTN_NON_USED_CALLBACK
+    BenchConfig.TimerNonUsed = 2000;
+#endif
+#if BTN_EVENT_HANDLER
+    BenchConfig.Handler = BenchHandler;
+    BenchConfig.EventMask = BTN_EVENT_MASK_ALL;
+#else
+    BenchConfig.ButtonPressed = BenchCallback;
+    BenchConfig.ButtonLongPressed = BenchCallback;
+    BenchConfig.ButtonRepeat = BenchCallback;
+    BenchConfig.ButtonRelease = BenchCallback;
+#if BTN_RELEASE_AFTER_REPEAT
+    BenchConfig.ButtonReleaseAfterRepeat = BenchCallback;
+#endif
+#if BTN_MULTIPLE_CLICK
+    BenchConfig.ButtonDoubleClick = BenchCallback;
+    BenchConfig.ButtonTripleClick = BenchCallback;
+#endif
+#if BTN_NON_USED_CALLBACK
+    BenchConfig.ButtonNonUsed = BenchCallback;
+#endif
+#endif
+}
+
+/**
+ * @brief Builds the benchmark trace on port 0.
+ *
+ * Pins 0-7 are held for 1.5 s (long press and repeats), pins 8-11 see a
+ * triple click burst, pins 12-15 stay idle. The replay step mirrors port 0 to
+ * all other ports. All edges bounce.
+ *
+ * @param Trace Pointer to the trace builder.
+ *
+ * @return None
+ */
+static void BenchTraceBuild(button_sim_trace_t *Trace)
+{
+    ButtonSimTraceInit(Trace, BenchRecords, BENCH_TRACE_RECORDS, 0xFFFFU);
+    ButtonSimTracePress(Trace, 100, 0, 0x00FFU, 1500, 4, NON_REVERSE);
+    ButtonSimTraceClicks(Trace, 2000, 0, 0x0F00U, 3, 80, 120, 3, NON_REVERSE);
+    ButtonSimTracePress(Trace, 3500, 0, 0x0FFFU, 60, 5, NON_REVERSE);
+}
+
+/**
+ * @brief Initializes `Count` buttons spread over the simulated ports.
+ *
+ * @param Run Pointer to the run to set up.
+ * @param Count Number of buttons.
+ *
+ * @return None
+ */
+static void BenchSetup(bench_run_t *Run, uint16_t Count)
+{
+    ButtonSimInit(0xFFFFU);
+    for (uint16_t i = 0; i < Count; i++)
+    {
+        ButtonInitKeyConfig(&BenchKeys[i], &ButtonSimPorts[i / BENCH_PINS_PER_PORT],
+                            (uint16_t)(1U << (i % BENCH_PINS_PER_PORT)), &BenchConfig, i);
+    }
+
+    Run->Keys = BenchKeys;
+    Run->KeysCount = Count;
+    Run->PortsCount = (uint8_t)((Count + BENCH_PINS_PER_PORT - 1U) / BENCH_PINS_PER_PORT);
+#if BTN_GROUP
+    Run->Group = (ButtonGroupInit(&BenchGroup, BenchKeys, Count) == BTN_OK) ? &BenchGroup : NULL;
+#endif
+    Run->Overhead = BenchOverhead();
+    Run->Total = 0;
+    Run->Calls = 0;
+    for (uint8_t State = 0; State < 8; State++)
+    {
+        Run->StateTime[State] = 0;
+        Run->StateCalls[State] = 0;
+    }
+}
+
+/**
+ * @brief Copies port 0 to the other ports used by the run.
+ *
+ * @param Run Pointer to the run.
+ *
+ * @return None
+ */
+static void BenchMirror(const bench_run_t *Run)
+{
+    for (uint8_t Port = 1; Port < Run->PortsCount; Port++)
+    {
+        ButtonSimPorts[Port].IDR = ButtonSimPorts[0].IDR;
+    }
+}
+
+/**
+ * @brief Delivers queued events outside of the measured section.
+ *
+ * @return None
+ */
+static void BenchDispatch(void)
+{
+#if BTN_EVENT_QUEUE
+    ButtonDispatchEvents();
+#endif
+}
+
+/* ========================== Replay Steps ========================= */
+/**
+ * @brief Runs one button per tick and measures every step by state.
+ */
+static void BenchStepState(void *Context, BTN_TIME_t Now)
+{
+    bench_run_t *Run = (bench_run_t *)Context;
+    uint8_t State = (uint8_t)(Run->Keys[0].State & 7U);
+    bench_time_t Start = BenchNow();
+    bench_time_t Time;
+
+    ButtonTaskAt(&Run->Keys[0], Now);
+    Time = (bench_time_t)(BenchNow() - Start);
+    Time = (Time > Run->Overhead) ? (bench_time_t)(Time - Run->Overhead) : 0;
+    Run->StateTime[State] += Time;
+    Run->StateCalls[State]++;
+    BenchDispatch();
+}
+
+/**
+ * @brief Runs all buttons of the run with `ButtonTaskAt()`.
+ */
+static void BenchStepKeys(void *Context, BTN_TIME_t Now)
+{
+    bench_run_t *Run = (bench_run_t *)Context;
+    bench_time_t Start;
+
+    BenchMirror(Run);
+    Start = BenchNow();
+    for (uint16_t i = 0; i < Run->KeysCount; i++)
+    {
+        ButtonTaskAt(&Run->Keys[i], Now);
+    }
+    Run->Total += (bench_time_t)(BenchNow() - Start);
+    Run->Calls += Run->KeysCount;
+    BenchDispatch();
+}
+
+#if BTN_GROUP
+/**
+ * @brief Runs the group of the run with `ButtonGroupTaskAt()`.
+ */
+static void BenchStepGroup(void *Context, BTN_TIME_t Now)
+{
+    bench_run_t *Run = (bench_run_t *)Context;
+    bench_time_t Start;
+
+    BenchMirror(Run);
+    Start = BenchNow();
+    ButtonGroupTaskAt(Run->Group, Now);
+    Run->Total += (bench_time_t)(BenchNow() - Start);
+    Run->Calls += Run->KeysCount;
+    BenchDispatch();
+}
+#endif
+
+/* ========================== Report ========================= */
+/**
+ * @brief Prints the enabled features, so reports of different builds can be
+ * compared.
+ *
+ * @return None
+ */
+static void BenchPrintFeatures(void)
+{
+    printf("features: MULTIPLE_CLICK=%d DOUBLE_DEBOUNCING=%d NON_USED_CALLBACK=%d RELEASE_AFTER_REPEAT=%d "
+           "SHARED_CONFIG=%d EVENT_QUEUE=%d EVENT_HANDLER=%d EDGE_WAKEUP=%d\n",
+           BTN_MULTIPLE_CLICK, BTN_DOUBLE_DEBOUNCING, BTN_NON_USED_CALLBACK, BTN_RELEASE_AFTER_REPEAT,
+           BTN_SHARED_CONFIG, BTN_EVENT_QUEUE, BTN_EVENT_HANDLER, BTN_EDGE_WAKEUP);
+}
+
+int main(void)
+{
+    static const char *const StateNames[8] = {"IDLE", "DEBOUNCE", "PRESSED", "REPEAT", "RELEASE",
+#if BTN_DOUBLE_DEBOUNCING
+                                              "DEBOUNCE_RELEASE",
+#endif
+#if BTN_RELEASE_AFTER_REPEAT
+                                              "RELEASE_AFTER_REPEAT",
+#endif
+    };
+    static const uint16_t Counts[] = {1, 16, 64, 256};
+    button_sim_trace_t Trace;
+    bench_run_t Run;
+
+    BenchTimerInit();
+    BenchConfigInit();
+    BenchTraceBuild(&Trace);
+    BenchPrintFeatures();
+    printf("trace: %u records, %u ticks\n", Trace.Count, BENCH_TRACE_TICKS);
+
+    BenchSetup(&Run, 1);
+    ButtonSimReplay(BenchRecords, Trace.Count, BENCH_TRACE_TICKS, BenchStepState, &Run);
+    printf("\nper state (1 button, ButtonTaskAt):\n");
+    for (uint8_t State = 0; State < 8; State++)
+    {
+        if (Run.StateCalls[State] != 0U && StateNames[State] != NULL)
+        {
+            printf("  %-22s %8lu calls %10.1f %s/call\n", StateNames[State], (unsigned long)Run.StateCalls[State],
+                   (double)Run.StateTime[State] / (double)Run.StateCalls[State], BENCH_UNIT);
+        }
+    }
+
+    printf("\nscaling (%s per button step):\n", BENCH_UNIT);
+    printf("  %8s %14s %16s\n", "buttons", "ButtonTaskAt", "ButtonGroupTaskAt");
+    for (uint8_t i = 0; i < sizeof(Counts) / sizeof(Counts[0]); i++)
+    {
+        double Keys;
+        double Group = -1.0;
+
+        BenchSetup(&Run, Counts[i]);
+        ButtonSimReplay(BenchRecords, Trace.Count, BENCH_TRACE_TICKS, BenchStepKeys, &Run);
+        Keys = (double)Run.Total / (double)Run.Calls;
+#if BTN_GROUP
+        if (Run.Group != NULL)
+        {
+            BenchSetup(&Run, Counts[i]);
+            ButtonSimReplay(BenchRecords, Trace.Count, BENCH_TRACE_TICKS, BenchStepGroup, &Run);
+            Group = (double)Run.Total / (double)Run.Calls;
+        }
+#endif
+        if (Group < 0.0)
+        {
+            printf("  %8u %14.1f %16s\n", Counts[i], Keys, "n/a");
+        }
+        else
+        {
+            printf("  %8u %14.1f %16.1f\n", Counts[i], Keys, Group);
+        }
+    }
+    printf("\nevents delivered: %lu\n", (unsigned long)BenchEvents);
+    return 0;
+}
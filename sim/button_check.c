@@ -0,0 +1,370 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+
+/*
+ * Replay check of the button state machine.
+ *
+ * Replays deterministic input traces (a bouncy short press, a long hold with
+ * repeats, a double click) through `ButtonTaskAt()` and `ButtonGroupTaskAt()`
+ * and compares the delivered events, with the tick of every event, against the
+ * expected sequences. Any difference is printed and the program exits with 1,
+ * so it can run as a regression check of both state machine cores.
+ *
+ * The expected sequences are written for the timings set up here and the
+ * shipped feature selection; `BTN_TABLE_CORE` may be 0 or 1 (the table core
+ * delivers a release on the tick it is accepted, the switch core one tick
+ * later). Built with `BTN_ATOMIC_CONFIG` (and edge wake-up), it also checks
+ * that a sleeping button adopts published configurations.
+ */
+
+#include "button_sim.h"
+#include <stdio.h>
+
+#if !BTN_MULTIPLE_CLICK || !BTN_DOUBLE_DEBOUNCING || !BTN_RELEASE_AFTER_REPEAT
+#error "button_check expects BTN_MULTIPLE_CLICK, BTN_DOUBLE_DEBOUNCING and BTN_RELEASE_AFTER_REPEAT"
+#endif
+
+#define CHECK_TRACE_RECORDS 256
+#define CHECK_TRACE_TICKS 3000
+#define CHECK_MAX_EVENTS 64
+
+/* Extra ticks until a release is delivered: the switch core spends one pass in the release state. */
+#if BTN_TABLE_CORE
+#define CHECK_RELEASE_DELAY 0U
+#else
+#define CHECK_RELEASE_DELAY 1U
+#endif
+
+/**
+ * @brief One delivered (or expected) event.
+ */
+typedef struct
+{
+    BTN_TIME_t Tick;      /**< Tick of the pass that delivered the event. */
+    uint16_t Number;      /**< Number of the button. */
+    button_event_t Event; /**< The event. */
+} check_event_t;
+
+/**
+ * @brief State of one replay, passed to the replay step routines.
+ */
+typedef struct
+{
+    button_t *Keys;     /**< Buttons under test. */
+    uint16_t KeysCount; /**< Number of buttons. */
+#if BTN_GROUP
+    button_group_t *Group; /**< Group of the buttons, NULL to run them one by one. */
+#endif
+} check_run_t;
+
+static button_t CheckKeys[2];
+static button_config_t CheckConfig[2];
+#if BTN_GROUP
+static button_group_t CheckGroup;
+#endif
+static button_sim_record_t CheckRecords[CHECK_TRACE_RECORDS];
+static check_event_t CheckLog[CHECK_MAX_EVENTS];
+static uint16_t CheckLogCount;
+static BTN_TIME_t CheckNow;
+
+/*
+ * Button 0 (pin 0): a short press at 100 and a long hold from 1000 to 1810.
+ * Debounced presses and releases are accepted 20 ticks after their first edge.
+ * Outside combined mode, `multipleClikRepeat()` reports the press of the first
+ * hold once more when it enters `REPEAT`.
+ * Button 1 (pin 1, combined multiple click mode): two clicks at 2200 and 2358,
+ * reported as a double click when the click window after the second press ends.
+ */
+static const check_event_t CheckExpected[] = {
+    {120, 0, BTN_EVENT_PRESSED},
+    {329 + CHECK_RELEASE_DELAY, 0, BTN_EVENT_RELEASE},
+    {1020, 0, BTN_EVENT_PRESSED},
+    {1520, 0, BTN_EVENT_LONG_PRESSED},
+    {1521, 0, BTN_EVENT_PRESSED},
+    {1620, 0, BTN_EVENT_REPEAT},
+    {1720, 0, BTN_EVENT_REPEAT},
+    {1830 + CHECK_RELEASE_DELAY, 0, BTN_EVENT_RELEASE_AFTER_REPEAT},
+    {2289 + CHECK_RELEASE_DELAY, 1, BTN_EVENT_RELEASE},
+    {2448 + CHECK_RELEASE_DELAY, 1, BTN_EVENT_RELEASE},
+    {2579, 1, BTN_EVENT_DOUBLE_CLICK},
+};
+
+/* ========================== Event Log ========================= */
+/**
+ * @brief Appends a delivered event to the log.
+ *
+ * @param Number Number of the button.
+ * @param Event The event.
+ *
+ * @return None
+ */
+static void CheckRecord(uint16_t Number, button_event_t Event)
+{
+    if (CheckLogCount < CHECK_MAX_EVENTS)
+    {
+        CheckLog[CheckLogCount].Tick = CheckNow;
+        CheckLog[CheckLogCount].Number = Number;
+        CheckLog[CheckLogCount].Event = Event;
+    }
+    CheckLogCount++;
+}
+
+#if BTN_EVENT_HANDLER
+static void CheckHandler(uint16_t Number, button_event_t Event, const button_event_info_t *Info)
+{
+    (void)Info;
+    CheckRecord(Number, Event);
+}
+#else
+static void CheckPressed(uint16_t Number)
+{
+    CheckRecord(Number, BTN_EVENT_PRESSED);
+}
+
+static void CheckLongPressed(uint16_t Number)
+{
+    CheckRecord(Number, BTN_EVENT_LONG_PRESSED);
+}
+
+static void CheckRepeat(uint16_t Number)
+{
+    CheckRecord(Number, BTN_EVENT_REPEAT);
+}
+
+static void CheckRelease(uint16_t Number)
+{
+    CheckRecord(Number, BTN_EVENT_RELEASE);
+}
+
+static void CheckReleaseAfterRepeat(uint16_t Number)
+{
+    CheckRecord(Number, BTN_EVENT_RELEASE_AFTER_REPEAT);
+}
+
+static void CheckDoubleClick(uint16_t Number)
+{
+    CheckRecord(Number, BTN_EVENT_DOUBLE_CLICK);
+}
+
+static void CheckTripleClick(uint16_t Number)
+{
+    CheckRecord(Number, BTN_EVENT_TRIPLE_CLICK);
+}
+#endif
+
+/**
+ * @brief Compares the log against an expected sequence.
+ *
+ * @param Name Name of the replay, printed with every difference.
+ * @param Expected Expected events.
+ * @param Count Number of expected events.
+ * @return 1 if the log matches, 0 otherwise.
+ */
+static uint8_t CheckCompare(const char *Name, const check_event_t *Expected, uint16_t Count)
+{
+    uint8_t Match = (CheckLogCount == Count);
+
+    for (uint16_t i = 0; i < Count && i < CheckLogCount && i < CHECK_MAX_EVENTS; i++)
+    {
+        if (CheckLog[i].Tick != Expected[i].Tick || CheckLog[i].Number != Expected[i].Number ||
+            CheckLog[i].Event != Expected[i].Event)
+        {
+            printf("%s: event %u is button %u event %d at %lu, expected button %u event %d at %lu\n", Name, i,
+                   CheckLog[i].Number, (int)CheckLog[i].Event, (unsigned long)CheckLog[i].Tick, Expected[i].Number,
+                   (int)Expected[i].Event, (unsigned long)Expected[i].Tick);
+            Match = 0;
+        }
+    }
+    if (CheckLogCount != Count)
+    {
+        printf("%s: %u events delivered, %u expected\n", Name, CheckLogCount, Count);
+    }
+    printf("%-24s %s\n", Name, Match ? "ok" : "FAILED");
+    return Match;
+}
+
+/* ========================== Setup ========================= */
+/**
+ * @brief Fills a configuration that reports every event to the log.
+ *
+ * @param Config Pointer to the configuration.
+ *
+ * @return None
+ */
+static void CheckConfigInit(button_config_t *Config)
+{
+    ButtonConfigInit(Config, 20, 500, 100, NON_REVERSE);
+#if BTN_EVENT_HANDLER
+    Config->Handler = CheckHandler;
+    Config->EventMask = BTN_EVENT_MASK_ALL;
+#else
+    Config->ButtonPressed = CheckPressed;
+    Config->ButtonLongPressed = CheckLongPressed;
+    Config->ButtonRepeat = CheckRepeat;
+    Config->ButtonRelease = CheckRelease;
+    Config->ButtonReleaseAfterRepeat = CheckReleaseAfterRepeat;
+    Config->ButtonDoubleClick = CheckDoubleClick;
+    Config->ButtonTripleClick = CheckTripleClick;
+#endif
+}
+
+/**
+ * @brief Builds the check trace on port 0.
+ *
+ * @param Trace Pointer to the trace builder.
+ *
+ * @return None
+ */
+static void CheckTraceBuild(button_sim_trace_t *Trace)
+{
+    ButtonSimTraceInit(Trace, CheckRecords, CHECK_TRACE_RECORDS, 0xFFFFU);
+    ButtonSimTracePress(Trace, 100, 0, 0x0001U, 200, 4, NON_REVERSE);
+    ButtonSimTracePress(Trace, 1000, 0, 0x0001U, 800, 3, NON_REVERSE);
+    ButtonSimTraceClicks(Trace, 2200, 0, 0x0002U, 2, 60, 80, 3, NON_REVERSE);
+}
+
+/**
+ * @brief Initializes the buttons of a replay and clears the log.
+ *
+ * @param Run Pointer to the run to set up.
+ * @param Group Non-zero to run the buttons through a group.
+ *
+ * @return None
+ */
+static void CheckSetup(check_run_t *Run, uint8_t Group)
+{
+    ButtonSimInit(0xFFFFU);
+    for (uint16_t i = 0; i < 2U; i++)
+    {
+        CheckConfigInit(&CheckConfig[i]);
+    }
+    CheckConfig[1].MultipleClickMode = BTN_MULTIPLE_CLICK_COMBINED_MODE;
+    CheckConfig[1].TimerBetweenClick = 200;
+    for (uint16_t i = 0; i < 2U; i++)
+    {
+        ButtonInitKeyConfig(&CheckKeys[i], &ButtonSimPorts[0], (uint16_t)(1U << i), &CheckConfig[i], i);
+    }
+
+    Run->Keys = CheckKeys;
+    Run->KeysCount = 2;
+#if BTN_GROUP
+    Run->Group = (Group && ButtonGroupInit(&CheckGroup, CheckKeys, 2) == BTN_OK) ? &CheckGroup : NULL;
+#else
+    (void)Group;
+#endif
+    CheckLogCount = 0;
+}
+
+/* ========================== Replay Steps ========================= */
+/**
+ * @brief Runs the buttons of the replay for one tick.
+ */
+static void CheckStep(void *Context, BTN_TIME_t Now)
+{
+    check_run_t *Run = (check_run_t *)Context;
+
+    CheckNow = Now;
+#if BTN_GROUP
+    if (Run->Group != NULL)
+    {
+        ButtonGroupTaskAt(Run->Group, Now);
+    }
+    else
+#endif
+    {
+        for (uint16_t i = 0; i < Run->KeysCount; i++)
+        {
+            ButtonTaskAt(&Run->Keys[i], Now);
+        }
+    }
+#if BTN_EVENT_QUEUE
+    ButtonDispatchEvents();
+#endif
+}
+
+#if BTN_ATOMIC_CONFIG && BTN_EDGE_WAKEUP
+/* ========================== Sleeping Publish ========================= */
+/**
+ * @brief Publishes configurations to a button asleep in edge wake-up mode.
+ *
+ * A sleeping button is skipped by its task, but it still has to adopt a
+ * published configuration at its next pass, without waking up; otherwise every
+ * further change of the button would fail as pending.
+ *
+ * @return 1 if the check passed, 0 otherwise.
+ */
+static uint8_t CheckSleepingPublish(void)
+{
+    static button_config_t Buffers[2];
+    button_t *Key = &CheckKeys[0];
+    const BTN_TIME_t Times[] = {300, 400};
+    BTN_TIME_t Now = 0;
+    uint8_t Match = 1;
+
+    ButtonSimInit(0xFFFFU);
+    CheckConfigInit(&CheckConfig[0]);
+    ButtonInitKeyConfig(Key, &ButtonSimPorts[0], 0x0001U, &CheckConfig[0], 0);
+    ButtonSetConfigBuffers(Key, Buffers);
+    ButtonSetEdgeWakeup(Key, 1);
+    for (; Now < 10U; Now++)
+    {
+        ButtonTaskAt(Key, Now);
+    }
+    if (!Key->Asleep)
+    {
+        printf("sleeping publish: button did not fall asleep\n");
+        Match = 0;
+    }
+
+    for (uint16_t i = 0; Match && i < sizeof(Times) / sizeof(Times[0]); i++)
+    {
+        if (ButtonSetLongPressedTime(Key, Times[i]) != BTN_OK)
+        {
+            printf("sleeping publish: change %u rejected\n", i);
+            Match = 0;
+            break;
+        }
+        ButtonTaskAt(Key, Now++);
+        if (ButtonConfigPending(Key) || Key->Config->TimerLongPressed != Times[i] || !Key->Asleep)
+        {
+            printf("sleeping publish: change %u %s, button %s\n", i,
+                   ButtonConfigPending(Key) ? "not adopted" : "adopted", Key->Asleep ? "asleep" : "awake");
+            Match = 0;
+        }
+    }
+    printf("%-24s %s\n", "sleeping publish", Match ? "ok" : "FAILED");
+    return Match;
+}
+#endif
+
+int main(void)
+{
+    button_sim_trace_t Trace;
+    check_run_t Run;
+    uint8_t Passed = 1;
+
+    CheckTraceBuild(&Trace);
+    printf("core: %s\n", BTN_TABLE_CORE ? "table" : "switch");
+
+    CheckSetup(&Run, 0);
+    ButtonSimReplay(CheckRecords, Trace.Count, CHECK_TRACE_TICKS, CheckStep, &Run);
+    Passed &= CheckCompare("ButtonTaskAt", CheckExpected, sizeof(CheckExpected) / sizeof(CheckExpected[0]));
+
+#if BTN_GROUP
+    CheckSetup(&Run, 1);
+    ButtonSimReplay(CheckRecords, Trace.Count, CHECK_TRACE_TICKS, CheckStep, &Run);
+    Passed &= CheckCompare("ButtonGroupTaskAt", CheckExpected, sizeof(CheckExpected) / sizeof(CheckExpected[0]));
+#endif
+#if BTN_ATOMIC_CONFIG && BTN_EDGE_WAKEUP
+    Passed &= CheckSleepingPublish();
+#endif
+
+    return Passed ? 0 : 1;
+}
@@ -0,0 +1,348 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+#include "button_sim.h"
+#include <stddef.h>
+
+GPIO_TypeDef ButtonSimPorts[BTN_SIM_MAX_PORTS];
+
+#if BTN_TICK_FROM_FUNC
+static BTN_TIME_t ButtonSimTick;
+
+/**
+ * @brief Tick source registered with the library.
+ *
+ * @return The simulated tick.
+ */
+static BTN_TIME_t ButtonSimGetTick(void)
+{
+    return ButtonSimTick;
+}
+#else
+static volatile BTN_TICK_VARIABLE_T ButtonSimTick;
+#endif
+
+/* ========================== Helper Functions ========================= */
+/**
+ * @brief Returns the next value of the bounce generator.
+ *
+ * @param Trace Pointer to the trace builder.
+ * @return Pseudo-random bounce pulse length, 1 or 2 ticks.
+ */
+static BTN_TIME_t ButtonSimBounceLength(button_sim_trace_t *Trace)
+{
+    Trace->Seed = Trace->Seed * 1664525U + 1013904223U;
+    return (BTN_TIME_t)(1U + ((Trace->Seed >> 16) & 1U));
+}
+
+/**
+ * @brief Appends a change of the pressed state of one pin.
+ *
+ * @param Trace Pointer to the trace builder.
+ * @param Tick Absolute tick of the change.
+ * @param Port Index of the port.
+ * @param Pin Pin mask.
+ * @param Pressed Non-zero for the pressed level.
+ * @param Logic `NON_REVERSE` for an active-low pin, `REVERSE` for active-high.
+ * @return Status of the operation.
+ */
+static BTN_operate_status ButtonSimTracePin(button_sim_trace_t *Trace, BTN_TIME_t Tick, uint8_t Port,
+                                            BTN_GPIO_PIN_T Pin, uint8_t Pressed, ReverseLogicGpio_t Logic)
+{
+    BTN_GPIO_PIN_T Level = Trace->Level[Port];
+
+    if ((Pressed != 0U) == (Logic == REVERSE))
+    {
+        Level |= Pin;
+    }
+    else
+    {
+        Level &= (BTN_GPIO_PIN_T)~Pin;
+    }
+    return ButtonSimTraceSet(Trace, Tick, Port, Level);
+}
+
+/**
+ * @brief Appends the bounce pulses of one edge.
+ *
+ * The pin leaves the target level and returns to it `Bounces` times.
+ *
+ * @param Trace Pointer to the trace builder.
+ * @param Tick In: tick of the first contact; out: tick of the stable level.
+ * @param Port Index of the port.
+ * @param Pin Pin mask.
+ * @param Pressed Target pressed state.
+ * @param Bounces Number of bounce pulses.
+ * @param Logic `NON_REVERSE` for an active-low pin, `REVERSE` for active-high.
+ * @return Status of the operation.
+ */
+static BTN_operate_status ButtonSimTraceEdge(button_sim_trace_t *Trace, BTN_TIME_t *Tick, uint8_t Port,
+                                             BTN_GPIO_PIN_T Pin, uint8_t Pressed, uint8_t Bounces,
+                                             ReverseLogicGpio_t Logic)
+{
+    if (ButtonSimTracePin(Trace, *Tick, Port, Pin, Pressed, Logic) != BTN_OK)
+    {
+        return BTN_ERROR;
+    }
+    for (uint8_t Bounce = 0; Bounce < Bounces; Bounce++)
+    {
+        *Tick = (BTN_TIME_t)(*Tick + ButtonSimBounceLength(Trace));
+        if (ButtonSimTracePin(Trace, *Tick, Port, Pin, !Pressed, Logic) != BTN_OK)
+        {
+            return BTN_ERROR;
+        }
+        *Tick = (BTN_TIME_t)(*Tick + ButtonSimBounceLength(Trace));
+        if (ButtonSimTracePin(Trace, *Tick, Port, Pin, Pressed, Logic) != BTN_OK)
+        {
+            return BTN_ERROR;
+        }
+    }
+    return BTN_OK;
+}
+
+/* ========================== Simulated Platform ========================= */
+/**
+ * @brief Resets the simulated ports and tick and registers the tick with the
+ * library.
+ *
+ * @param IdleLevel Initial value of every input register.
+ *
+ * @return None
+ */
+void ButtonSimInit(BTN_GPIO_PIN_T IdleLevel)
+{
+    for (uint8_t Port = 0; Port < BTN_SIM_MAX_PORTS; Port++)
+    {
+        ButtonSimPorts[Port].IDR = IdleLevel;
+        ButtonSimPorts[Port].ODR = 0;
+        ButtonSimPorts[Port].BSRR = 0;
+    }
+    ButtonSimTick = 0;
+#if BTN_TICK_FROM_FUNC
+    BTN_tick_function_register(ButtonSimGetTick);
+#else
+    BTN_tick_variable_register(&ButtonSimTick);
+#endif
+}
+
+/**
+ * @brief Sets the simulated tick.
+ *
+ * @param Tick New tick value.
+ *
+ * @return None
+ */
+void ButtonSimSetTick(BTN_TIME_t Tick)
+{
+    ButtonSimTick = Tick;
+}
+
+/* ========================== Trace Builder ========================= */
+/**
+ * @brief Starts building a trace.
+ *
+ * @param Trace Pointer to the trace builder.
+ * @param Records Record storage.
+ * @param Capacity Number of records `Records` can hold.
+ * @param IdleLevel Level of every port at tick 0.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonSimTraceInit(button_sim_trace_t *Trace, button_sim_record_t *Records, uint16_t Capacity,
+                                      BTN_GPIO_PIN_T IdleLevel)
+{
+    if (Trace == NULL || Records == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    Trace->Records = Records;
+    Trace->Capacity = Capacity;
+    Trace->Count = 0;
+    Trace->LastTick = 0;
+    Trace->Seed = 1U;
+    for (uint8_t Port = 0; Port < BTN_SIM_MAX_PORTS; Port++)
+    {
+        Trace->Level[Port] = IdleLevel;
+    }
+    return BTN_OK;
+}
+
+/**
+ * @brief Appends a change of one port's input register.
+ *
+ * Gaps longer than a record's `Delta` range are bridged with records that
+ * repeat the current value.
+ *
+ * @param Trace Pointer to the trace builder.
+ * @param Tick Absolute tick of the change, not before the last record.
+ * @param Port Index of the port.
+ * @param Value New input register value.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the record was stored (or the value did not change).
+ *         - `BTN_ERROR` if the trace is full or `Tick` is out of order.
+ */
+BTN_operate_status ButtonSimTraceSet(button_sim_trace_t *Trace, BTN_TIME_t Tick, uint8_t Port,
+                                     BTN_GPIO_PIN_T Value)
+{
+    BTN_TIME_t Delta;
+
+    if (Trace == NULL || Port >= BTN_SIM_MAX_PORTS || Tick < Trace->LastTick)
+    {
+        return BTN_ERROR;
+    }
+    if (Trace->Level[Port] == Value)
+    {
+        return BTN_OK;
+    }
+
+    Delta = (BTN_TIME_t)(Tick - Trace->LastTick);
+#if BTN_MAX_TIMEOUT > UINT16_MAX
+    while (Delta > UINT16_MAX)
+    {
+        if (Trace->Count >= Trace->Capacity)
+        {
+            return BTN_ERROR;
+        }
+        Trace->Records[Trace->Count].Delta = UINT16_MAX;
+        Trace->Records[Trace->Count].Port = Port;
+        Trace->Records[Trace->Count].Value = Trace->Level[Port];
+        Trace->Count++;
+        Delta = (BTN_TIME_t)(Delta - UINT16_MAX);
+    }
+#endif
+    if (Trace->Count >= Trace->Capacity)
+    {
+        return BTN_ERROR;
+    }
+    Trace->Records[Trace->Count].Delta = (uint16_t)Delta;
+    Trace->Records[Trace->Count].Port = Port;
+    Trace->Records[Trace->Count].Value = Value;
+    Trace->Count++;
+    Trace->LastTick = Tick;
+    Trace->Level[Port] = Value;
+    return BTN_OK;
+}
+
+/**
+ * @brief Appends a bouncy press of one pin.
+ *
+ * @param Trace Pointer to the trace builder.
+ * @param Tick Tick of the first contact.
+ * @param Port Index of the port.
+ * @param Pin Pin mask.
+ * @param Duration Stable pressed time.
+ * @param Bounces Number of bounce pulses on press and on release.
+ * @param Logic `NON_REVERSE` for an active-low pin, `REVERSE` for active-high.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the press was stored.
+ *         - `BTN_ERROR` if the trace is full or out of order.
+ */
+BTN_operate_status ButtonSimTracePress(button_sim_trace_t *Trace, BTN_TIME_t Tick, uint8_t Port, BTN_GPIO_PIN_T Pin,
+                                       BTN_TIME_t Duration, uint8_t Bounces, ReverseLogicGpio_t Logic)
+{
+    if (Trace == NULL || Port >= BTN_SIM_MAX_PORTS ||
+        ButtonSimTraceEdge(Trace, &Tick, Port, Pin, 1, Bounces, Logic) != BTN_OK)
+    {
+        return BTN_ERROR;
+    }
+    Tick = (BTN_TIME_t)(Tick + Duration);
+    return ButtonSimTraceEdge(Trace, &Tick, Port, Pin, 0, Bounces, Logic);
+}
+
+/**
+ * @brief Appends a burst of bouncy clicks of one pin.
+ *
+ * @param Trace Pointer to the trace builder.
+ * @param Tick Tick of the first contact.
+ * @param Port Index of the port.
+ * @param Pin Pin mask.
+ * @param Clicks Number of clicks.
+ * @param PressTime Stable pressed time of every click.
+ * @param GapTime Released time between two clicks.
+ * @param Bounces Number of bounce pulses on every edge.
+ * @param Logic `NON_REVERSE` for an active-low pin, `REVERSE` for active-high.
+ * @return Status of the operation:
+ *         - `BTN_OK` if the burst was stored.
+ *         - `BTN_ERROR` if the trace is full or out of order.
+ */
+BTN_operate_status ButtonSimTraceClicks(button_sim_trace_t *Trace, BTN_TIME_t Tick, uint8_t Port,
+                                        BTN_GPIO_PIN_T Pin, uint8_t Clicks, BTN_TIME_t PressTime, BTN_TIME_t GapTime,
+                                        uint8_t Bounces, ReverseLogicGpio_t Logic)
+{
+    if (Trace == NULL || Port >= BTN_SIM_MAX_PORTS)
+    {
+        return BTN_ERROR;
+    }
+
+    for (uint8_t Click = 0; Click < Clicks; Click++)
+    {
+        if (ButtonSimTraceEdge(Trace, &Tick, Port, Pin, 1, Bounces, Logic) != BTN_OK)
+        {
+            return BTN_ERROR;
+        }
+        Tick = (BTN_TIME_t)(Tick + PressTime);
+        if (ButtonSimTraceEdge(Trace, &Tick, Port, Pin, 0, Bounces, Logic) != BTN_OK)
+        {
+            return BTN_ERROR;
+        }
+        Tick = (BTN_TIME_t)(Tick + GapTime);
+    }
+    return BTN_OK;
+}
+
+/* ========================== Replayer ========================= */
+/**
+ * @brief Replays a trace tick by tick through the simulated ports.
+ *
+ * @param Records Trace records.
+ * @param Count Number of records.
+ * @param Duration Number of ticks to simulate.
+ * @param Step Routine called once per tick.
+ * @param Context User context passed to `Step`.
+ * @return Status of the replay:
+ *         - `BTN_OK` if the replay completed.
+ *         - `BTN_ERROR` if a record references an invalid port.
+ */
+BTN_operate_status ButtonSimReplay(const button_sim_record_t *Records, uint16_t Count, BTN_TIME_t Duration,
+                                   button_sim_step_t Step, void *Context)
+{
+    uint16_t Next = 0;
+    BTN_TIME_t Due = 0;
+
+    if ((Records == NULL && Count != 0U) || Step == NULL)
+    {
+        return BTN_ERROR;
+    }
+
+    if (Count != 0U)
+    {
+        Due = Records[0].Delta;
+    }
+    for (BTN_TIME_t Now = 0; Now < Duration; Now++)
+    {
+        while (Next < Count && Due == Now)
+        {
+            if (Records[Next].Port >= BTN_SIM_MAX_PORTS)
+            {
+                return BTN_ERROR;
+            }
+            ButtonSimPorts[Records[Next].Port].IDR = Records[Next].Value;
+            Next++;
+            if (Next < Count)
+            {
+                Due = (BTN_TIME_t)(Due + Records[Next].Delta);
+            }
+        }
+        ButtonSimSetTick(Now);
+        Step(Context, Now);
+    }
+    return BTN_OK;
+}
@@ -0,0 +1,217 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+
+#ifndef INC_BUTTON_SIM_H_
+#define INC_BUTTON_SIM_H_
+
+/*
+ * Host simulation port of the button library.
+ *
+ * Provides a mock of the GPIO port registers and a simulated tick, so the
+ * library and the application's button logic can be built and run on a PC.
+ * Every library source has to see the mock before `button.h`, e.g. with
+ * `gcc -include sim/button_sim.h`.
+ */
+
+#include <stdint.h>
+
+#ifndef BTN_SIM_NO_GPIO_MOCK
+/**
+ * @brief Mock of the GPIO port registers used by the library.
+ */
+typedef struct
+{
+    volatile uint32_t IDR;  /**< Input data register, driven by the simulation. */
+    volatile uint32_t ODR;  /**< Output data register. */
+    volatile uint32_t BSRR; /**< Bit set/reset register (last value written). */
+} GPIO_TypeDef;
+#endif
+
+/**
+ * @brief Maximum number of simulated GPIO ports.
+ */
+#define BTN_SIM_MAX_PORTS 16
+
+/*
+ * A group may span all simulated ports and hold 256 buttons, so all buttons of
+ * the benchmark on 16-pin ports still fit into one group.
+ */
+#ifndef BTN_GROUP_MAX_PORTS
+#define BTN_GROUP_MAX_PORTS BTN_SIM_MAX_PORTS
+#endif
+#ifndef BTN_GROUP_MAX_KEYS
+#define BTN_GROUP_MAX_KEYS 256
+#endif
+
+#include "../button.h"
+
+#if BTN_CAPTURE
+/**
+ * @brief One record of an input trace.
+ *
+ * Same record as a group capture (`button_capture_record_t`), so a trace
+ * exported by `ButtonCaptureExport()` on the target replays as it is. Port `i`
+ * of the capture is simulated port `i`; build the group on `ButtonSimPorts` in
+ * the order of the captured group's ports.
+ */
+typedef button_capture_record_t button_sim_record_t;
+#else
+/**
+ * @brief One record of an input trace.
+ *
+ * `Delta` ticks after the previous record (or after tick 0 for the first one),
+ * the input register of port `Port` takes the value `Value`. Records are only
+ * stored on change, so a trace of a quiet input is short.
+ */
+typedef struct
+{
+    uint16_t Delta;       /**< Ticks since the previous record. */
+    uint8_t Port;         /**< Index of the simulated port. */
+    BTN_GPIO_PIN_T Value; /**< New input register value of the port. */
+} button_sim_record_t;
+#endif
+
+/**
+ * @brief Builder of a deterministic input trace.
+ *
+ * Input changes are appended in increasing tick order into a caller-provided
+ * record array. Bounce patterns come from a fixed-seed pseudo-random generator,
+ * so every build of a trace is identical.
+ */
+typedef struct
+{
+    button_sim_record_t *Records;            /**< Record storage. */
+    uint16_t Capacity;                       /**< Number of records `Records` can hold. */
+    uint16_t Count;                          /**< Number of stored records. */
+    BTN_TIME_t LastTick;                     /**< Tick of the last stored record. */
+    BTN_GPIO_PIN_T Level[BTN_SIM_MAX_PORTS]; /**< Port levels after the last record. */
+    uint32_t Seed;                           /**< State of the bounce generator. */
+} button_sim_trace_t;
+
+/**
+ * @brief Called by the replayer once per simulated tick, after the inputs of
+ * that tick have been applied.
+ *
+ * @param Context User context passed to `ButtonSimReplay()`.
+ * @param Now Simulated tick.
+ */
+typedef void (*button_sim_step_t)(void *Context, BTN_TIME_t Now);
+
+/**
+ * @brief Simulated GPIO ports, indexed by `button_sim_record_t::Port`.
+ */
+extern GPIO_TypeDef ButtonSimPorts[BTN_SIM_MAX_PORTS];
+
+/**
+ * @brief Resets the simulated ports and tick and registers the tick with the
+ * library.
+ *
+ * All input registers are set to `IdleLevel` (e.g. 0xFFFF for active-low
+ * buttons with pull-ups).
+ *
+ * @param IdleLevel Initial value of every input register.
+ */
+void ButtonSimInit(BTN_GPIO_PIN_T IdleLevel);
+
+/**
+ * @brief Sets the simulated tick returned by the library's tick source.
+ *
+ * @param Tick New tick value.
+ */
+void ButtonSimSetTick(BTN_TIME_t Tick);
+
+/**
+ * @brief Starts building a trace.
+ *
+ * @param Trace Pointer to the trace builder.
+ * @param Records Record storage.
+ * @param Capacity Number of records `Records` can hold.
+ * @param IdleLevel Level of every port at tick 0.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the operation was successful.
+ *         - `BTN_ERROR` if there was an error during the operation.
+ */
+BTN_operate_status ButtonSimTraceInit(button_sim_trace_t *Trace, button_sim_record_t *Records, uint16_t Capacity,
+                                      BTN_GPIO_PIN_T IdleLevel);
+
+/**
+ * @brief Appends a change of one port's input register.
+ *
+ * @param Trace Pointer to the trace builder.
+ * @param Tick Absolute tick of the change, not before the last record.
+ * @param Port Index of the port.
+ * @param Value New input register value.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the record was stored (or the value did not change).
+ *         - `BTN_ERROR` if the trace is full or `Tick` is out of order.
+ */
+BTN_operate_status ButtonSimTraceSet(button_sim_trace_t *Trace, BTN_TIME_t Tick, uint8_t Port,
+                                     BTN_GPIO_PIN_T Value);
+
+/**
+ * @brief Appends a bouncy press of one pin.
+ *
+ * The pin bounces for `Bounces` short pulses after `Tick`, stays pressed for
+ * `Duration` ticks and bounces again on release.
+ *
+ * @param Trace Pointer to the trace builder.
+ * @param Tick Tick of the first contact.
+ * @param Port Index of the port.
+ * @param Pin Pin mask.
+ * @param Duration Stable pressed time.
+ * @param Bounces Number of bounce pulses on press and on release.
+ * @param Logic `NON_REVERSE` for an active-low pin, `REVERSE` for active-high.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the press was stored.
+ *         - `BTN_ERROR` if the trace is full or out of order.
+ */
+BTN_operate_status ButtonSimTracePress(button_sim_trace_t *Trace, BTN_TIME_t Tick, uint8_t Port, BTN_GPIO_PIN_T Pin,
+                                       BTN_TIME_t Duration, uint8_t Bounces, ReverseLogicGpio_t Logic);
+
+/**
+ * @brief Appends a burst of bouncy clicks of one pin.
+ *
+ * @param Trace Pointer to the trace builder.
+ * @param Tick Tick of the first contact.
+ * @param Port Index of the port.
+ * @param Pin Pin mask.
+ * @param Clicks Number of clicks.
+ * @param PressTime Stable pressed time of every click.
+ * @param GapTime Released time between two clicks.
+ * @param Bounces Number of bounce pulses on every edge.
+ * @param Logic `NON_REVERSE` for an active-low pin, `REVERSE` for active-high.
+ * @retval Status of the operation:
+ *         - `BTN_OK` if the burst was stored.
+ *         - `BTN_ERROR` if the trace is full or out of order.
+ */
+BTN_operate_status ButtonSimTraceClicks(button_sim_trace_t *Trace, BTN_TIME_t Tick, uint8_t Port,
+                                        BTN_GPIO_PIN_T Pin, uint8_t Clicks, BTN_TIME_t PressTime, BTN_TIME_t GapTime,
+                                        uint8_t Bounces, ReverseLogicGpio_t Logic);
+
+/**
+ * @brief Replays a trace tick by tick through the simulated ports.
+ *
+ * For every tick from 0 to `Duration - 1` the replayer sets the simulated
+ * tick, applies all records due at that tick to `ButtonSimPorts` and calls
+ * `Step`, which typically runs `ButtonTask()` / `ButtonGroupTask()`.
+ *
+ * @param Records Trace records.
+ * @param Count Number of records.
+ * @param Duration Number of ticks to simulate.
+ * @param Step Routine called once per tick.
+ * @param Context User context passed to `Step`.
+ * @retval Status of the replay:
+ *         - `BTN_OK` if the replay completed.
+ *         - `BTN_ERROR` if a record references an invalid port.
+ */
+BTN_operate_status ButtonSimReplay(const button_sim_record_t *Records, uint16_t Count, BTN_TIME_t Duration,
+                                   button_sim_step_t Step, void *Context);
+
+#endif /* INC_BUTTON_SIM_H_ */